@@ -0,0 +1,203 @@
+/***************************************************************************************[Async.cc]
+ Same licence as the rest of Glucose (see LICENCE).
+ **************************************************************************************************/
+
+#include <chrono>
+#include <thread>
+
+#include "utils/Options.h"
+#include "utils/System.h"
+#include "utils/Threads.h"
+#include "core/Async.h"
+
+using namespace Glucose;
+
+static IntOption opt_async_threads("CORE", "async-threads", "Threads running the solves of 'solveAsync' (0=one per core)", 0, IntRange(0, INT32_MAX));
+
+//=================================================================================================
+// AsyncPool -- FIFO of queued solves and the threads running them:
+
+namespace Glucose {
+
+class AsyncPool {
+    std::mutex              m;
+    std::condition_variable work;
+    vec<AsyncSolve*>        queue;
+    int                     head;
+    int                     nThreads, idle;
+
+    void loop();
+
+public:
+    AsyncPool() : head(0), nThreads(0), idle(0) { }
+
+    void submit(AsyncSolve* h);
+    bool remove(AsyncSolve* h);     // TRUE if 'h' was still queued.
+};
+
+}
+
+// Threads are detached and the pool is never destroyed: the threads idle in it until exit.
+static AsyncPool& pool() {
+    static AsyncPool* p = new AsyncPool();
+    return *p;
+}
+
+void AsyncPool::submit(AsyncSolve* h) {
+    std::lock_guard<std::mutex> lock(m);
+    queue.push(h);
+    if (idle == 0 && nThreads < effectiveThreads(opt_async_threads)) {
+        nThreads++;
+        std::thread(&AsyncPool::loop, this).detach();
+    } else
+        work.notify_one();
+}
+
+bool AsyncPool::remove(AsyncSolve* h) {
+    std::lock_guard<std::mutex> lock(m);
+    for (int i = head; i < queue.size(); i++)
+        if (queue[i] == h) {
+            for (int j = i; j > head; j--) queue[j] = queue[j - 1];
+            head++;
+            return true; }
+    return false;
+}
+
+void AsyncPool::loop() {
+    for (;;) {
+        AsyncSolve* h;
+        {
+            std::unique_lock<std::mutex> lock(m);
+            idle++;
+            work.wait(lock, [this]{ return head < queue.size(); });
+            idle--;
+            h = queue[head++];
+            if (head == queue.size()) { queue.clear(); head = 0; }
+        }
+        h->run();
+    }
+}
+
+
+//=================================================================================================
+// AsyncSolve:
+
+AsyncSolve::AsyncSolve(Solver& s, const vec<Lit>& as, double t, Callback cb, void* d, double p) :
+    S(s), timeout(t), period(p), callback(cb), data(d), start(0), nextReport(0),
+    st(Queued), res(l_Undef), expired(false), cancelled(false)
+{
+    as.copyTo(assumps);
+}
+
+AsyncSolve::~AsyncSolve() {
+    cancel();
+    wait();
+}
+
+AsyncSolve::State AsyncSolve::state() const {
+    std::lock_guard<std::mutex> lock(m);
+    return st;
+}
+
+bool AsyncSolve::wait(double seconds) {
+    std::unique_lock<std::mutex> lock(m);
+    if (seconds < 0)
+        finished.wait(lock, [this]{ return st == Finished; });
+    else
+        finished.wait_for(lock, std::chrono::duration<double>(seconds), [this]{ return st == Finished; });
+    return st == Finished;
+}
+
+void AsyncSolve::cancel() {
+    bool dequeued = pool().remove(this);
+    std::lock_guard<std::mutex> lock(m);
+    cancelled = true;
+    if (dequeued) {
+        st = Finished;
+        finished.notify_all();
+    } else if (st == Running)
+        S.interrupt();
+}
+
+lbool AsyncSolve::result() const {
+    std::lock_guard<std::mutex> lock(m);
+    return st == Finished ? res : l_Undef;
+}
+
+bool AsyncSolve::timedOut() const {
+    std::lock_guard<std::mutex> lock(m);
+    return expired;
+}
+
+SolveProgress AsyncSolve::progress() const {
+    std::lock_guard<std::mutex> lock(m);
+    return snap;
+}
+
+void AsyncSolve::run() {
+    {
+        std::lock_guard<std::mutex> lock(m);
+        if (cancelled) {
+            st = Finished;
+            finished.notify_all();
+            return; }
+        st = Running;
+    }
+    start      = realTime();
+    nextReport = start + period;
+    S.async    = this;
+    lbool r    = S.solveLimited(assumps);
+    S.async    = NULL;
+    report(realTime());
+
+    // Finishing and clearing the interrupt under the lock, so that a late 'cancel' cannot leave
+    // the solver interrupted. The handle may be deleted as soon as the lock is released.
+    std::lock_guard<std::mutex> lock(m);
+    res = r;
+    st  = Finished;
+    S.clearInterrupt();
+    finished.notify_all();
+}
+
+bool AsyncSolve::tick() {
+    double now = realTime();
+    if (timeout >= 0 && now - start >= timeout) {
+        { std::lock_guard<std::mutex> lock(m); expired = true; }
+        S.interrupt();
+        return false; }
+    if (now >= nextReport) {
+        report(now);
+        nextReport = now + period; }
+    return !cancelled;
+}
+
+void AsyncSolve::report(double now) {
+    SolveProgress p;
+    p.conflicts            = S.conflicts;
+    p.decisions            = S.decisions;
+    p.propagations         = S.propagations;
+    p.restarts             = S.starts;
+    p.bridge_decisions     = S.bridge_decisions;
+    p.highcenter_decisions = S.highcenter_decisions;
+    p.learnts              = S.nLearnts();
+    p.lbdAvg               = S.conflictsRestarts > 0 ? S.sumLBD / S.conflictsRestarts : 0;
+    p.lbdRecent            = S.lbdQueue.isvalid() ? S.lbdQueue.getavgDouble() : 0;
+    p.time                 = now - start;
+    {
+        std::lock_guard<std::mutex> lock(m);
+        snap = p;
+    }
+    if (callback != NULL) callback(data, p);
+}
+
+
+//=================================================================================================
+// solveAsync:
+
+AsyncSolve* Glucose::solveAsync(Solver& S, const vec<Lit>& assumps, double timeout,
+                                AsyncSolve::Callback cb, void* data, double period)
+{
+    AsyncSolve* h = new AsyncSolve(S, assumps, timeout, cb, data, period);
+    pool().submit(h);
+    return h;
+}
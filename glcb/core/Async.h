@@ -0,0 +1,106 @@
+/****************************************************************************************[Async.h]
+ Asynchronous solving: solves run on a shared pool of background threads and are followed through
+ handles (polling, progress callbacks, timeouts, cancellation).
+
+ Same licence as the rest of Glucose (see LICENCE).
+ **************************************************************************************************/
+
+#ifndef Glucose_Async_h
+#define Glucose_Async_h
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <stdint.h>
+
+#include "mtl/Vec.h"
+#include "core/Solver.h"
+
+namespace Glucose {
+
+//=================================================================================================
+// SolveProgress -- snapshot of the statistics of a running solve:
+
+struct SolveProgress {
+    uint64_t conflicts, decisions, propagations, restarts;
+    uint64_t bridge_decisions, highcenter_decisions;
+    int      learnts;
+    double   lbdAvg;       // Mean LBD of the clauses learnt so far.
+    double   lbdRecent;    // Mean LBD over the restart window (0 until it is full).
+    double   time;         // Wall time since the solve started.
+
+    SolveProgress() : conflicts(0), decisions(0), propagations(0), restarts(0), bridge_decisions(0),
+                      highcenter_decisions(0), learnts(0), lbdAvg(0), lbdRecent(0), time(0) { }
+};
+
+
+//=================================================================================================
+// AsyncSolve -- handle of a solve started by 'solveAsync':
+//
+// The solve waits in the queue of the pool (-async-threads threads, started on first use), then
+// runs 'solveLimited' on its thread. Budgets set on the solver beforehand still apply. The search
+// loop looks at the handle every 64 conflicts: it stops once the timeout has passed, and every
+// 'period' seconds it takes a snapshot and calls the callback on the pool thread. The callback
+// is called a last time when the solve ends, before the handle turns 'Finished'. With
+// -threads > 1 or -cube-depth the search runs in clones of the solver, so only cancellation and
+// the final snapshot apply.
+//
+// Deleting the handle cancels the solve and waits for it. The solver must not be used otherwise
+// until then.
+
+class AsyncSolve {
+public:
+    typedef void (*Callback)(void* data, const SolveProgress& progress);
+    enum State { Queued, Running, Finished };
+
+    ~AsyncSolve();
+
+    State         state   () const;
+    bool          wait    (double seconds = -1);   // Block until finished, or at most 'seconds' if >= 0. TRUE if finished.
+    void          cancel  ();                      // Make the solve finish soon with l_Undef; any thread.
+    lbool         result  () const;                // l_True/l_False, or l_Undef (unfinished, cancelled, timed out or out of budget).
+    bool          timedOut() const;
+    SolveProgress progress() const;                // The latest snapshot.
+
+private:
+    Solver&                 S;
+    vec<Lit>                assumps;
+    double                  timeout, period;
+    Callback                callback;
+    void*                   data;
+    double                  start, nextReport;
+
+    mutable std::mutex      m;
+    std::condition_variable finished;
+    State                   st;
+    lbool                   res;
+    bool                    expired;
+    std::atomic<bool>       cancelled;
+    SolveProgress           snap;
+
+    AsyncSolve(Solver& S, const vec<Lit>& assumps, double timeout, Callback cb, void* data, double period);
+
+    void run   ();                 // On a pool thread.
+    bool tick  ();                 // From the search of 'S': FALSE to stop.
+    void report(double now);
+
+    friend class Solver;
+    friend class AsyncPool;
+    friend AsyncSolve* solveAsync(Solver&, const vec<Lit>&, double, Callback, void*, double);
+};
+
+
+//=================================================================================================
+// solveAsync -- queue a solve of 'S' under 'assumps' and return its handle at once:
+//
+// 'timeout' is in wall seconds (< 0 for none); 'cb', if not NULL, receives 'data' and a snapshot
+// about every 'period' seconds. Solves of different solvers run concurrently, up to the size of
+// the pool; the caller owns the handle.
+
+AsyncSolve* solveAsync(Solver& S, const vec<Lit>& assumps, double timeout = -1,
+                       AsyncSolve::Callback cb = NULL, void* data = NULL, double period = 1);
+
+//=================================================================================================
+}
+
+#endif
@@ -130,6 +130,19 @@ public:
 
     void clear(bool dealloc = false)   { elems.clear(dealloc); first = 0; maxsize=0; queuesize=0;sumofqueue=0;}
 
+    // Checkpoints (core/Checkpoint.h), with a 'CheckpointWriter' or a 'CheckpointReader':
+    template<class W> void save(W& out) {
+        out.put(maxsize); out.put(first); out.put(last); out.put(queuesize); out.put(sumofqueue); out.put(exp);
+        out.put((T*)elems, maxsize); }
+
+    template<class R> void load(R& in) {
+        in.get(maxsize); in.get(first); in.get(last); in.get(queuesize); in.get(sumofqueue); in.get(exp);
+        if (maxsize < 0) maxsize = 0;
+        elems.clear();
+        elems.growTo(maxsize, 0);
+        in.get((T*)elems, maxsize);
+        expComputed = false; }
+
     void copyTo(bqueue &dest) const {
         dest.last = last;
         dest.sumofqueue = sumofqueue;
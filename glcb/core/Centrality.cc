@@ -0,0 +1,247 @@
+/**********************************************************************************[Centrality.cc]
+ Same licence as the rest of Glucose (see LICENCE).
+ **************************************************************************************************/
+
+#include <math.h>
+#include <atomic>
+
+#include "mtl/Heap.h"
+#include "core/Centrality.h"
+#include "utils/System.h"
+#include "utils/Threads.h"
+
+using namespace Glucose;
+
+//=================================================================================================
+// Single source shortest paths:
+
+namespace {
+
+struct DistLt {
+    const vec<double>& dist;
+    DistLt(const vec<double>& d) : dist(d) { }
+    bool operator () (int x, int y) const { return dist[x] < dist[y]; }
+};
+
+static inline double edgeLength(double w, EdgeLength len) {
+    return len == InverseLength ? 1 / w : 1 / (w * w); }
+
+// Path lengths are sums of floating point values: equal up to a relative tolerance.
+static inline bool sameLength(double x, double y) {
+    return fabs(x - y) <= 1e-12 * (x > y ? x : y); }
+
+static inline uint64_t xorshift(uint64_t& r) {
+    r ^= r << 13; r ^= r >> 7; r ^= r << 17;
+    return r; }
+
+// Per-thread state of the shortest path searches. 'dist' is negative for unreached nodes.
+struct PathState {
+    vec<double>  dist, sigma, delta;
+    vec<int>     order;        // Settled nodes, in non-decreasing distance from the source.
+    vec<int>     touched;      // Reached nodes (settled or not).
+    Heap<DistLt> queue;
+
+    PathState(int n) : dist(n, -1), sigma(n, 0), delta(n, 0), queue(DistLt(dist)) { }
+
+    // Dijkstra from 's' counting shortest paths in 'sigma'. Stops once 'target' is settled (-1 to
+    // explore the whole component).
+    void search(const WGraph& g, int s, EdgeLength len, int target = -1) {
+        dist[s]  = 0;
+        sigma[s] = 1;
+        touched.push(s);
+        queue.insert(s);
+        while (!queue.empty()) {
+            int v = queue.removeMin();
+            order.push(v);
+            if (v == target) break;
+            for (int e = g.start[v]; e < g.start[v + 1]; e++) {
+                int w = g.adj[e];
+                if (w == v) continue;
+                double nd = dist[v] + edgeLength(g.weight[e], len);
+                if (dist[w] < 0) {
+                    dist[w]  = nd;
+                    sigma[w] = sigma[v];
+                    touched.push(w);
+                    queue.insert(w);
+                } else if (sameLength(nd, dist[w]))
+                    sigma[w] += sigma[v];
+                else if (nd < dist[w]) {
+                    dist[w]  = nd;
+                    sigma[w] = sigma[v];
+                    queue.decrease(w);
+                }
+            }
+        }
+        queue.clear();
+    }
+
+    // Adds the dependencies of source 's' to 'bc' (Brandes). Predecessors are recovered from the
+    // distances instead of being stored.
+    void accumulate(const WGraph& g, int s, EdgeLength len, vec<double>& bc) {
+        search(g, s, len);
+        for (int i = order.size() - 1; i >= 0; i--) {
+            int w = order[i];
+            for (int e = g.start[w]; e < g.start[w + 1]; e++) {
+                int v = g.adj[e];
+                if (v == w || dist[v] < 0) continue;
+                if (sameLength(dist[v] + edgeLength(g.weight[e], len), dist[w]))
+                    delta[v] += sigma[v] / sigma[w] * (1 + delta[w]);
+            }
+            if (w != s) bc[w] += delta[w];
+        }
+        reset();
+    }
+
+    // Draws one shortest path from 's' to 't' uniformly at random and adds 'inc' to its internal
+    // nodes. Returns FALSE if 't' is unreachable.
+    bool samplePath(const WGraph& g, int s, int t, EdgeLength len, double inc, vec<double>& bc, uint64_t& rnd) {
+        search(g, s, len, t);
+        bool found = dist[t] >= 0;
+        for (int w = t; found && w != s; ) {
+            // Predecessor 'v' is chosen with probability sigma[v] / sigma[w]:
+            double r    = (xorshift(rnd) >> 11) * (1.0 / 9007199254740992.0) * sigma[w];
+            int    pred = -1;
+            for (int e = g.start[w]; e < g.start[w + 1]; e++) {
+                int v = g.adj[e];
+                if (v == w || dist[v] < 0) continue;
+                if (sameLength(dist[v] + edgeLength(g.weight[e], len), dist[w])) {
+                    pred = v;
+                    if ((r -= sigma[v]) < 0) break;
+                }
+            }
+            if (pred < 0) break;
+            w = pred;
+            if (w != s) bc[w] += inc;
+        }
+        reset();
+        return found;
+    }
+
+    void reset() {
+        for (int i = 0; i < touched.size(); i++) {
+            int v = touched[i];
+            dist[v] = -1, sigma[v] = 0, delta[v] = 0;
+        }
+        touched.clear();
+        order.clear();
+    }
+};
+
+}
+
+// Sums the per-thread scores into 'bc', dividing them by 'div', optionally normalised by the max.
+static void mergeScores(vec<double>* partial, int nthreads, int n, double div, bool normalize, vec<double>& bc)
+{
+    bc.clear();
+    bc.growTo(n, 0);
+    double max = 0;
+    for (int v = 0; v < n; v++) {
+        for (int t = 0; t < nthreads; t++) bc[v] += partial[t][v];
+        bc[v] /= div;
+        if (bc[v] > max) max = bc[v];
+    }
+    if (normalize && max > 0)
+        for (int v = 0; v < n; v++) bc[v] /= max;
+}
+
+//=================================================================================================
+// Exact betweenness:
+
+void Glucose::betweenness(const WGraph& g, vec<double>& bc, EdgeLength len, bool normalize, int nthreads)
+{
+    int n = g.nNodes();
+    nthreads = effectiveThreads(nthreads);
+    if (nthreads > n) nthreads = n > 0 ? n : 1;
+
+    vec<double>*     partial = new vec<double>[nthreads];
+    std::atomic<int> next(0);
+
+    runThreads(nthreads, [&](int t) {
+        PathState st(n);
+        partial[t].growTo(n, 0);
+        for (int s; (s = next.fetch_add(1)) < n; )
+            if (g.degree(s) > 0)
+                st.accumulate(g, s, len, partial[t]);
+    });
+
+    // Undirected: every pair was seen from both ends.
+    mergeScores(partial, nthreads, n, 2, normalize, bc);
+    delete [] partial;
+}
+
+//=================================================================================================
+// Approximate betweenness:
+
+int Glucose::sampleSize(const WGraph& g, EdgeLength len, double eps, double delta)
+{
+    // Vertex diameter bound of each connected component (Riondato & Kornaropoulos, weighted case):
+    // from any node, two nodes at distances d1 and d2 are at most d1+d2 apart, and a shortest path
+    // of that length has at most (d1+d2)/lmin edges, lmin being the shortest edge. The bound can
+    // not exceed the size of the component.
+    PathState  st(g.nNodes());
+    vec<bool>  seen(g.nNodes(), false);
+    int        live = 0;
+    double     vd   = 0;
+    for (int v = 0; v < g.nNodes(); v++) {
+        if (g.degree(v) == 0 || seen[v]) continue;
+        st.search(g, v, len);
+        double lmin = HUGE_VAL;
+        for (int i = 0; i < st.order.size(); i++) {
+            int x = st.order[i];
+            seen[x] = true;
+            for (int e = g.start[x]; e < g.start[x + 1]; e++)
+                if (g.adj[e] != x && edgeLength(g.weight[e], len) < lmin) lmin = edgeLength(g.weight[e], len);
+        }
+        int    size = st.order.size();
+        double cvd  = size;
+        if (size >= 2 && lmin > 0 && lmin < HUGE_VAL) {
+            double d = st.dist[st.order[size - 1]] + st.dist[st.order[size - 2]];
+            double b = floor(d / lmin * (1 + 1e-9)) + 1;   // Slack for rounding in the distances.
+            if (b < cvd) cvd = b;
+        }
+        if (cvd > vd) vd = cvd;
+        live += size;
+        st.reset();
+    }
+    if (live < 2) return 0;
+
+    if (vd < 3) vd = 3;
+    double r  = 0.5 / (eps * eps) * (floor(log2(vd - 2)) + 1 + log(1 / delta));
+    return r > 1e9 ? 1000000000 : (int)ceil(r);
+}
+
+int Glucose::approxBetweenness(const WGraph& g, vec<double>& bc, EdgeLength len, double eps, double delta,
+                               bool normalize, int nthreads, double time_limit)
+{
+    int    n        = g.nNodes();
+    double deadline = time_limit > 0 ? realTime() + time_limit : HUGE_VAL;
+    int    r        = sampleSize(g, len, eps, delta);
+    nthreads = effectiveThreads(nthreads);
+
+    vec<int> live;
+    for (int v = 0; v < n; v++)
+        if (g.degree(v) > 0) live.push(v);
+
+    vec<double>*     partial = new vec<double>[nthreads];
+    std::atomic<int> next(0), drawn(0);
+
+    runThreads(nthreads, [&](int t) {
+        PathState st(n);
+        uint64_t  rnd   = 0x9E3779B97F4A7C15ULL * (uint64_t)(t + 1);
+        int       local = 0;
+        partial[t].growTo(n, 0);
+        while (next.fetch_add(1) < r) {
+            if (realTime() > deadline) break;
+            int s = live[xorshift(rnd) % live.size()], d;
+            do d = live[xorshift(rnd) % live.size()]; while (d == s);
+            st.samplePath(g, s, d, len, 1, partial[t], rnd);
+            local++;
+        }
+        drawn += local;
+    });
+
+    // An interrupted run is scaled by the samples actually drawn (with a weaker guarantee).
+    mergeScores(partial, nthreads, n, drawn > 0 ? (double)drawn : 1, normalize, bc);
+    delete [] partial;
+    return drawn;
+}
@@ -0,0 +1,55 @@
+/***********************************************************************************[Centrality.h]
+ Betweenness centrality on the graphs of core/Graph.h.
+
+ Same licence as the rest of Glucose (see LICENCE).
+ **************************************************************************************************/
+
+#ifndef Glucose_Centrality_h
+#define Glucose_Centrality_h
+
+#include "mtl/Vec.h"
+#include "core/Graph.h"
+
+namespace Glucose {
+
+// How an edge weight (a strength of connection) is turned into a path length:
+enum EdgeLength {
+    InverseLength       = 0,   // length = 1/w
+    InverseSquareLength = 1    // length = 1/w^2
+};
+
+//=================================================================================================
+// Exact weighted betweenness (Brandes, 2001):
+//
+// One Dijkstra search per source; sources are distributed among 'nthreads' threads, each with its
+// own score array, and the arrays are summed at the end. Each unordered pair of end points is
+// counted once. With 'normalize', scores are divided by the largest one (so they lie in [0,1]),
+// matching the '*Normalized' centrality files used with -center-file.
+
+void betweenness(const WGraph& g, vec<double>& bc, EdgeLength len, bool normalize, int nthreads);
+
+
+//=================================================================================================
+// Approximate betweenness by shortest path sampling (Riondato & Kornaropoulos, 2016):
+//
+// Each sample draws a pair of distinct non-isolated nodes and one of their shortest paths
+// uniformly at random, and credits the internal nodes of that path. With
+//     r = 0.5/eps^2 * (floor(log2(VD-2)) + 1 + ln(1/delta))
+// samples, VD being (an upper bound on) the number of nodes of a shortest path, every score is
+// within 'eps' of the fraction of shortest paths through the node with probability '1-delta'.
+// Samples are drawn by 'nthreads' threads until 'r' are taken or 'time_limit' seconds of wall
+// time have elapsed (non positive = no limit); an interrupted run is scaled by the samples actually
+// drawn and loses the guarantee. Returns the number of samples drawn.
+
+int approxBetweenness(const WGraph& g, vec<double>& bc, EdgeLength len, double eps, double delta,
+                      bool normalize, int nthreads, double time_limit);
+
+// Number of samples 'r' needed by 'approxBetweenness'. VD is bounded with one search per connected
+// component, by 1 + (d1+d2)/lmin (d1, d2 the two largest distances from its first node, lmin its
+// shortest edge) or the component size if smaller; the largest bound over the components is used.
+int sampleSize(const WGraph& g, EdgeLength len, double eps, double delta);
+
+//=================================================================================================
+}
+
+#endif
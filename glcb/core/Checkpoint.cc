@@ -0,0 +1,322 @@
+/**********************************************************************************[Checkpoint.cc]
+ Same licence as the rest of Glucose (see LICENCE).
+ **************************************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "core/Solver.h"
+#include "core/Checkpoint.h"
+
+using namespace Glucose;
+
+static const char checkpointMagic[8] = { 'G', 'L', 'C', 'B', 'C', 'K', 'P', 'T' };
+
+uint64_t Glucose::checkpointHash(uint64_t h, const void* data, size_t n) {
+    const unsigned char* p = (const unsigned char*)data;
+    for (size_t i = 0; i < n; i++) {
+        h ^= p[i];
+        h *= 1099511628211ULL; }
+    return h;
+}
+
+void CheckpointWriter::append(const void* p, size_t n) {
+    sum    = checkpointHash(sum, p, n);
+    bytes += n;
+    if (buf.size() + n > (1 << 20)) flush();
+    if (n >= (1 << 20)) {                           // Large arrays go straight to the file.
+        if (!failed && fwrite(p, 1, n, f) != n) failed = true;
+        return; }
+    int at = buf.size();
+    buf.growTo(at + (int)n);
+    memcpy(&buf[at], p, n);
+}
+
+bool CheckpointWriter::flush() {
+    if (!failed && buf.size() > 0 && fwrite((char*)buf, 1, buf.size(), f) != (size_t)buf.size())
+        failed = true;
+    buf.clear();
+    return !failed;
+}
+
+bool CheckpointReader::take(void* out, size_t n) {
+    if (!valid || (size_t)(end - p) < n) {
+        valid = false;
+        memset(out, 0, n);
+        return false; }
+    memcpy(out, p, n);
+    p += n;
+    return true;
+}
+
+
+//=================================================================================================
+// Solver state:
+
+
+// Everything the search schedules and statistics depend on, besides the clauses, the variables
+// and the restart queues. Read and written in this order (change 'CheckpointHeader::Version'
+// with it).
+template<class Stream>
+void Solver::stateScalars(Stream& s) {
+    s.field(solves);              s.field(starts);            s.field(decisions);
+    s.field(rnd_decisions);       s.field(propagations);      s.field(conflicts);
+    s.field(conflictsRestarts);   s.field(nbstopsrestarts);   s.field(nbstopsrestartssame);
+    s.field(lastblockatrestart);  s.field(nbReduceDB);        s.field(nbRemovedClauses);
+    s.field(nbRemovedUnaryWatchedClauses);                    s.field(nbReducedClauses);
+    s.field(nbDL2);               s.field(nbBin);             s.field(nbUn);
+    s.field(dec_vars);            s.field(max_literals);      s.field(tot_literals);
+    s.field(nbPromoted);          s.field(originalClausesSeen); s.field(sumDecisionLevels);
+    s.field(bridge_decisions);    s.field(highbridge_decisions); s.field(highdegree_decisions);
+    s.field(highcenter_decisions); s.field(mutual_decisions);  s.field(mutualbrgcenter_decisions);
+    s.field(mutualhdhc_decisions);
+
+    s.field(curRestart);          s.field(nbclausesbeforereduce);
+    s.field(sumLBD);              s.field(learntsize_adjust_cnt);
+    s.field(panicModeLastRemoved); s.field(panicModeLastRemovedShared);
+
+    s.field(var_inc);             s.field(var_incx);          s.field(var_decay);
+    s.field(cla_inc);             s.field(random_seed);       s.field(progress_estimate);
+    s.field(max_learnts);         s.field(learntsize_adjust_confl);
+}
+
+
+/*_________________________________________________________________________________________________
+|
+|  writeState : (out : CheckpointWriter&)  ->  [void]
+|
+|  Description:
+|    Writes the search state in the layout of core/Checkpoint.h: the scalars, the restart queues,
+|    the variables, the root facts, the problem and learnt clauses and the graph metadata. Only
+|    the root level of the trail is kept, so it may be called between restarts.
+|________________________________________________________________________________________________@*/
+void Solver::writeState(CheckpointWriter& out) {
+    stateScalars(out);
+    lbdQueue.save(out);
+    trailQueue.save(out);
+
+    out.put((double*)activity, nVars());
+    out.put((char*)polarity,   nVars());
+    out.put((char*)decision,   nVars());
+
+    int root = trail_lim.size() > 0 ? trail_lim[0] : trail.size();
+    out.put(root);
+    for (int i = 0; i < root; i++) out.put((int32_t)toInt(trail[i]));
+
+    int n = 0;
+    for (int i = 0; i < clauses.size(); i++)
+        if (ca[clauses[i]].mark() == 0) n++;
+    out.put(n);
+    for (int i = 0; i < clauses.size(); i++) {
+        const Clause& c = ca[clauses[i]];
+        if (c.mark() != 0) continue;
+        out.put((uint32_t)c.size());
+        for (int j = 0; j < c.size(); j++) out.put((int32_t)toInt(c[j])); }
+
+    out.put(learnts.size());
+    for (int i = 0; i < learnts.size(); i++) {
+        Clause& c = ca[learnts[i]];
+        out.put((uint32_t)c.size());
+        out.put((uint32_t)c.sizeWithoutSelectors());
+        out.put((uint32_t)(c.lbd() | (c.canBeDel() ? 1u << 31 : 0)));
+        out.put(c.activity());
+        for (int j = 0; j < c.size(); j++) out.put((int32_t)toInt(c[j])); }
+
+    if (!metadataReady) {
+        out.put((int32_t)-1);
+        return; }
+    out.put(nbCommunities);
+    if (cmtycentrality.size() < nbCommunities + 1)
+        cmtycentrality.growTo(nbCommunities + 1, 0);
+    out.put((double*)cmtycentrality, nbCommunities + 1);
+    out.put((int*)cmtys,          nVars());
+    out.put((int*)numbridges,     nVars());
+    out.put((bool*)bridges,       nVars());
+    out.put((double*)centrality,  nVars());
+}
+
+
+/*_________________________________________________________________________________________________
+|
+|  readState : (in : CheckpointReader&)  ->  [void]
+|
+|  Description:
+|    Drops the clauses, the root facts and the clause arena, then rebuilds them from a stream of
+|    'writeState' for the same variables. The restored facts are taken as propagated, as they
+|    were when written. The graph metadata, if present, replaces the detection at the next
+|    'initMetadata', which derives the tiers from it again.
+|________________________________________________________________________________________________@*/
+void Solver::readState(CheckpointReader& in) {
+    cancelUntil(0);
+    for (int i = 0; i < trail.size(); i++) {
+        assigns[var(trail[i])] = l_Undef;
+        vardata[var(trail[i])] = mkVarData(CRef_Undef, 0); }
+    trail.clear();
+    qhead = 0;
+    for (int i = 0; i < 2 * nVars(); i++) {
+        watches[toLit(i)].clear();
+        watchesBin[toLit(i)].clear();
+        unaryWatches[toLit(i)].clear(); }
+    watches.cleanAll();
+    watchesBin.cleanAll();
+    unaryWatches.cleanAll();
+    clauses.clear();
+    learnts.clear();
+    unaryWatchedClauses.clear();
+    ClauseAllocator fresh;
+    fresh.extra_clause_field = ca.extra_clause_field;
+    fresh.moveTo(ca);
+    lastLearntClause = CRef_Undef;
+    clauses_literals = learnts_literals = 0;
+
+    stateScalars(in);
+    lbdQueue.load(in);
+    trailQueue.load(in);
+
+    in.get((double*)activity, nVars());
+    in.get((char*)polarity,   nVars());
+    in.get((char*)decision,   nVars());
+
+    int32_t n = 0, x = 0;
+    in.get(n);
+    for (int i = 0; i < n && in.ok(); i++) {
+        in.get(x);
+        if (in.check(x >= 0 && x < 2 * nVars() && value(toLit(x)) == l_Undef))
+            uncheckedEnqueue(toLit(x)); }
+    qhead = trail.size();
+    simpDB_assigns = -1;
+    simpDB_props   = 0;
+
+    vec<Lit> ps;
+    for (int learnt = 0; learnt < 2; learnt++) {
+        in.get(n);
+        for (int i = 0; i < n && in.ok(); i++) {
+            uint32_t size = 0, sizeWithoutSelectors = 0, lbd = 0;
+            float    act  = 0;
+            in.get(size);
+            if (learnt) {
+                in.get(sizeWithoutSelectors);
+                in.get(lbd);
+                in.get(act); }
+            if (!in.check(size >= 1 && size <= (uint32_t)nVars())) break;
+            ps.clear();
+            for (uint32_t j = 0; j < size; j++) {
+                in.get(x);
+                in.check(x >= 0 && x < 2 * nVars());
+                ps.push(toLit(x)); }
+            if (!in.ok() || ps.size() < 2) {
+                in.check(ps.size() >= 2);
+                break; }
+
+            CRef cr = ca.alloc(ps, learnt);
+            if (learnt) {
+                Clause& c = ca[cr];
+                c.setLBD(lbd & ~(1u << 31));
+                c.setCanBeDel((lbd >> 31) != 0);
+                c.setSizeWithoutSelectors(sizeWithoutSelectors);
+                c.activity() = act;
+                learnts.push(cr);
+            } else
+                clauses.push(cr);
+            attachClause(cr);
+        }
+    }
+    rebuildOrderHeap();
+
+    int32_t ncmtys = 0;
+    in.get(ncmtys);
+    metadataReady    = false;
+    metadataRestored = ncmtys >= 0;
+    metaVars = metaClauses = 0;
+    metaAdded.clear();
+    if (!metadataRestored || !in.check(ncmtys <= nVars())) return;
+    nbCommunities = ncmtys;
+    if (cmtycentrality.size() < nbCommunities + 1)
+        cmtycentrality.growTo(nbCommunities + 1, 0);
+    in.get((double*)cmtycentrality, nbCommunities + 1);
+    in.get((int*)cmtys,         nVars());
+    in.get((int*)numbridges,    nVars());
+    in.get((bool*)bridges,      nVars());
+    in.get((double*)centrality, nVars());
+    for (int i = 0; i < nVars(); i++) {
+        cmtystruct[i]  = 0;
+        cmtybridges[i] = 0; }
+    for (int i = 0; i < nVars() && in.check(cmtys[i] >= 0 && cmtys[i] < nVars()); i++) {
+        cmtystruct[cmtys[i]]++;
+        if (bridges[i]) cmtybridges[cmtys[i]]++; }
+}
+
+
+/*_________________________________________________________________________________________________
+|
+|  saveCheckpoint : (path : const char*) (key : uint64_t)  ->  [bool]
+|
+|  Description:
+|    Writes the search state to 'path' (through a temporary file renamed into place, so an
+|    earlier checkpoint survives a failed write), for the formula of 'key'.
+|________________________________________________________________________________________________@*/
+bool Solver::saveCheckpoint(const char* path, uint64_t key) {
+    CheckpointHeader h;
+    memset(&h, 0, sizeof(h));
+    memcpy(h.magic, checkpointMagic, sizeof(checkpointMagic));
+    h.version = CheckpointHeader::Version;
+    h.nVars   = nVars();
+    h.key     = key;
+
+    char* tmp = new char[strlen(path) + 5];
+    sprintf(tmp, "%s.tmp", path);
+    FILE* f       = fopen(tmp, "wb");
+    bool  written = f != NULL;
+    if (written) {
+        CheckpointWriter out(f);
+        written = fwrite(&h, sizeof(h), 1, f) == 1;        // Completed below, once the body is known.
+        writeState(out);
+        written    = out.flush() && written;
+        h.size     = sizeof(h) + out.size();
+        h.checksum = out.checksum();
+        written = written && fseek(f, 0, SEEK_SET) == 0 && fwrite(&h, sizeof(h), 1, f) == 1;
+        written = fclose(f) == 0 && written;
+        written = written && rename(tmp, path) == 0;
+        if (!written) ::remove(tmp);
+    }
+    delete [] tmp;
+    return written;
+}
+
+
+/*_________________________________________________________________________________________________
+|
+|  loadCheckpoint : (path : const char*) (key : uint64_t)  ->  [bool]
+|
+|  Description:
+|    Reads a file of 'saveCheckpoint' written for the formula of 'key' and replaces the search
+|    state by its own. Called at decision level 0, right after parsing (before any simplification,
+|    the file holding the simplified clauses). Returns FALSE, with the solver unchanged, if the
+|    file is missing, truncated, damaged or for another formula.
+|________________________________________________________________________________________________@*/
+bool Solver::loadCheckpoint(const char* path, uint64_t key) {
+    FILE* f = fopen(path, "rb");
+    if (f == NULL) return false;
+
+    CheckpointHeader h;
+    bool valid = fread(&h, sizeof(h), 1, f) == 1
+           && memcmp(h.magic, checkpointMagic, sizeof(checkpointMagic)) == 0 && h.version == CheckpointHeader::Version
+           && h.key == key && h.nVars == (uint32_t)nVars() && h.size >= sizeof(h);
+    size_t n    = valid ? h.size - sizeof(h) : 0;
+    char*  body = valid ? (char*)malloc(n > 0 ? n : 1) : NULL;
+    valid = valid && body != NULL && fread(body, 1, n, f) == n && fgetc(f) == EOF
+            && checkpointHash(14695981039346656037ULL, body, n) == h.checksum;
+    fclose(f);
+    if (!valid) {
+        free(body);
+        return false; }
+
+    CheckpointReader in(body, n);
+    readState(in);
+    free(body);
+    // The checksum matched, so this is a file of another build of the solver:
+    if (!in.ok() || !in.atEnd())
+        fprintf(stderr, "checkpoint %s does not match this solver\n", path), exit(1);
+    return true;
+}
@@ -0,0 +1,115 @@
+/***********************************************************************************[Checkpoint.h]
+ Binary snapshot of the complete search state, so that a search stopped by a preemption (signal,
+ CPU limit) resumes where it left off instead of from the start.
+
+ Layout (native endianness, version 'CheckpointHeader::Version'):
+
+     header     CheckpointHeader                      (64 bytes)
+     scalars    statistics, schedules and increments  (in the order of 'Solver::stateScalars')
+     queues     lbdQueue, trailQueue                  (as 'bqueue::save')
+     double     activity[nVars]
+     uint8      polarity[nVars], decision[nVars]
+     int32      nTrail, trail[nTrail]                 (the root facts, as 'toInt(lit)')
+     int32      nClauses, then per problem clause:    uint32 size, int32 lits[size]
+     int32      nLearnts, then per learnt clause:     uint32 size, uint32 sizeWithoutSelectors,
+                                                      uint32 lbd | canbedel << 31, float activity,
+                                                      int32 lits[size]
+     int32      nCmtys, -1 if the graph metadata was not computed yet, else:
+                double cmtyCentrality[nCmtys + 1], int32 cmty[nVars], int32 numBridges[nVars],
+                uint8 bridge[nVars], double centrality[nVars]
+     simp       SimpSolver only: uint8 eliminated[nVars], uint8 frozen[nVars],
+                int32 nElim, uint32 elimclauses[nElim], int32 eliminated_vars, merges, asymm_lits
+
+ The clause arena is not dumped as is: the clauses are rewritten one after the other and
+ allocated again on load, which compacts the arena. The file is keyed by 'Solver::formulaKey'
+ of the parsed formula, and carries its size and a checksum of everything after the header, so
+ a truncated file or one of another formula is ignored.
+
+ Same licence as the rest of Glucose (see LICENCE).
+ **************************************************************************************************/
+
+#ifndef Glucose_Checkpoint_h
+#define Glucose_Checkpoint_h
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "mtl/Vec.h"
+
+namespace Glucose {
+
+struct CheckpointHeader {
+    enum { Version = 1 };
+
+    char     magic[8];     // "GLCBCKPT"
+    uint32_t version;
+    uint32_t nVars;
+    uint64_t key;
+    uint64_t size;         // Total file size, to detect truncated files.
+    uint64_t checksum;     // FNV-1a of everything after the header.
+    char     pad[24];
+};
+
+//=================================================================================================
+// CheckpointWriter / CheckpointReader -- the body of a checkpoint as a stream of plain values:
+//
+// Both offer 'field', which writes or reads one value, so that a list of fields serves for both
+// directions. The reader never reads past its buffer: after a short read 'ok' is FALSE and the
+// values read are zero.
+
+class CheckpointWriter {
+    FILE*     f;
+    vec<char> buf;
+    uint64_t  sum;
+    uint64_t  bytes;
+    bool      failed;
+
+    void append(const void* p, size_t n);
+
+public:
+    explicit CheckpointWriter(FILE* out) : f(out), sum(14695981039346656037ULL), bytes(0), failed(false) { }
+
+    template<class T> void put  (const T* xs, int n)  { append(xs, sizeof(T) * n); }
+    template<class T> void put  (const T& x)          { append(&x, sizeof(T)); }
+    template<class T> void put  (vec<T>& xs)          { put(xs.size()); put((T*)xs, xs.size()); }
+    template<class T> void field(T& x)                { put(x); }
+
+    bool     flush   ();                          // FALSE if a write failed.
+    uint64_t size    () const { return bytes; }
+    uint64_t checksum() const { return sum; }
+};
+
+class CheckpointReader {
+    const char* p;
+    const char* end;
+    bool        valid;
+
+    bool take(void* out, size_t n);
+
+public:
+    CheckpointReader(const char* data, size_t n) : p(data), end(data + n), valid(true) { }
+
+    template<class T> void get  (T* xs, int n)  { if (n < 0) valid = false; else take(xs, sizeof(T) * n); }
+    template<class T> void get  (T& x)          { take(&x, sizeof(T)); }
+    template<class T> void get  (vec<T>& xs)    {
+        int n = 0;
+        get(n);
+        xs.clear();
+        if (n < 0 || (size_t)n > (size_t)(end - p) / sizeof(T)) { valid = false; return; }
+        xs.growTo(n);
+        get((T*)xs, n); }
+    template<class T> void field(T& x)          { get(x); }
+
+    bool check(bool c)   { valid = valid && c; return valid; }   // Marks the stream as damaged unless 'c'.
+    bool ok   () const { return valid; }
+    bool atEnd() const { return p == end; }
+};
+
+// FNV-1a hash of 'n' bytes, continuing from 'h'.
+uint64_t checkpointHash(uint64_t h, const void* data, size_t n);
+
+//=================================================================================================
+}
+
+#endif
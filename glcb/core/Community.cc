@@ -0,0 +1,337 @@
+/***********************************************************************************[Community.cc]
+ Same licence as the rest of Glucose (see LICENCE).
+ **************************************************************************************************/
+
+#include <math.h>
+#include <atomic>
+
+#include "core/Community.h"
+#include "utils/System.h"
+#include "utils/Threads.h"
+
+using namespace Glucose;
+
+//=================================================================================================
+// Helpers:
+
+// Modularity of a partition given, for every community, the weight inside it ('in', both
+// directions counted) and the total strength of its nodes ('tot').
+static double partitionModularity(const vec<double>& in, const vec<double>& tot, double m2)
+{
+    if (m2 <= 0) return 0;
+    double q = 0;
+    for (int c = 0; c < tot.size(); c++)
+        if (tot[c] > 0)
+            q += in[c] / m2 - (tot[c] / m2) * (tot[c] / m2);
+    return q;
+}
+
+int Glucose::renumberCommunities(vec<int>& n2c)
+{
+    int max = -1;
+    for (int i = 0; i < n2c.size(); i++)
+        if (n2c[i] > max) max = n2c[i];
+
+    vec<int> map(max + 1, -1);
+    int      k = 0;
+    for (int i = 0; i < n2c.size(); i++) {
+        if (map[n2c[i]] == -1) map[n2c[i]] = k++;
+        n2c[i] = map[n2c[i]];
+    }
+    return k;
+}
+
+// Louvain phase 1: nodes are greedily moved to the neighbouring community giving the largest
+// modularity gain, until a full pass improves modularity by less than 'min_gain'. Returns TRUE
+// if at least one node changed community.
+static bool localMoving(const WGraph& g, vec<int>& n2c, double min_gain, double& q)
+{
+    int         n = g.nNodes();
+    vec<double> str(n), self(n), tot(n), in(n);
+    double      m2 = 0;
+
+    n2c.clear();
+    n2c.growTo(n);
+    for (int v = 0; v < n; v++) {
+        str[v]  = g.strength(v);
+        self[v] = g.selfLoop(v);
+        m2     += str[v];
+        n2c[v]  = v;
+        tot[v]  = str[v];
+        in[v]   = self[v];
+    }
+    q = partitionModularity(in, tot, m2);
+    if (m2 <= 0) return false;
+
+    vec<double> neighW(n, -1);
+    vec<int>    neighC;
+    bool        moved = false;
+
+    for (;;) {
+        int moves = 0;
+        for (int v = 0; v < n; v++) {
+            int cv = n2c[v];
+
+            // Weights from 'v' to each neighbouring community (its own one included):
+            neighC.clear();
+            neighW[cv] = 0;
+            neighC.push(cv);
+            for (int e = g.start[v]; e < g.start[v + 1]; e++) {
+                int u = g.adj[e];
+                if (u == v) continue;
+                int c = n2c[u];
+                if (neighW[c] < 0) {
+                    neighW[c] = 0;
+                    neighC.push(c);
+                }
+                neighW[c] += g.weight[e];
+            }
+
+            // Remove 'v' from its community and insert it into the best one:
+            tot[cv] -= str[v];
+            in [cv] -= 2 * neighW[cv] + self[v];
+
+            int    best     = cv;
+            double bestGain = neighW[cv] - tot[cv] * str[v] / m2;
+            for (int k = 1; k < neighC.size(); k++) {
+                int    c    = neighC[k];
+                double gain = neighW[c] - tot[c] * str[v] / m2;
+                if (gain > bestGain) {
+                    best     = c;
+                    bestGain = gain;
+                }
+            }
+
+            tot[best] += str[v];
+            in [best] += 2 * neighW[best] + self[v];
+            n2c[v]     = best;
+            if (best != cv) moves++;
+
+            for (int k = 0; k < neighC.size(); k++)
+                neighW[neighC[k]] = -1;
+        }
+
+        double nq = partitionModularity(in, tot, m2);
+        if (moves > 0) moved = true;
+        bool stop = moves == 0 || nq - q < min_gain;
+        q = nq;
+        if (stop) break;
+    }
+
+    return moved;
+}
+
+// Louvain phase 2: builds the graph whose nodes are the 'k' communities of 'n2c'.
+static void aggregate(const WGraph& g, const vec<int>& n2c, int k, WGraph& out)
+{
+    int n = g.nNodes();
+
+    vec<int> mstart(k + 1, 0);
+    for (int v = 0; v < n; v++) mstart[n2c[v] + 1]++;
+    for (int c = 0; c < k; c++) mstart[c + 1] += mstart[c];
+    vec<int> members(n);
+    vec<int> fill(k, 0);
+    for (int v = 0; v < n; v++) members[mstart[n2c[v]] + fill[n2c[v]]++] = v;
+
+    out.clear();
+    out.start.growTo(k + 1, 0);
+    vec<double> acc(k, 0);
+    vec<int>    mark(k, -1);
+    vec<int>    touched;
+    for (int c = 0; c < k; c++) {
+        touched.clear();
+        for (int m = mstart[c]; m < mstart[c + 1]; m++) {
+            int v = members[m];
+            for (int e = g.start[v]; e < g.start[v + 1]; e++) {
+                int d = n2c[g.adj[e]];
+                if (mark[d] != c) {
+                    mark[d] = c;
+                    acc[d]  = 0;
+                    touched.push(d);
+                }
+                acc[d] += g.weight[e];
+            }
+        }
+        for (int t = 0; t < touched.size(); t++) {
+            out.adj.push(touched[t]);
+            out.weight.push(acc[touched[t]]);
+        }
+        out.start[c + 1] = out.adj.size();
+    }
+}
+
+//=================================================================================================
+// Public interface:
+
+double Glucose::modularity(const WGraph& g, const vec<int>& cmty)
+{
+    int k = 0;
+    for (int v = 0; v < cmty.size(); v++)
+        if (cmty[v] + 1 > k) k = cmty[v] + 1;
+
+    vec<double> in(k, 0), tot(k, 0);
+    double      m2 = 0;
+    for (int v = 0; v < g.nNodes(); v++)
+        for (int e = g.start[v]; e < g.start[v + 1]; e++) {
+            tot[cmty[v]] += g.weight[e];
+            m2           += g.weight[e];
+            if (cmty[g.adj[e]] == cmty[v]) in[cmty[v]] += g.weight[e];
+        }
+    return partitionModularity(in, tot, m2);
+}
+
+double Glucose::louvain(const WGraph& g, vec<int>& cmty, double min_gain)
+{
+    int n = g.nNodes();
+    cmty.clear();
+    cmty.growTo(n);
+    for (int v = 0; v < n; v++) cmty[v] = v;
+
+    WGraph        level;
+    const WGraph* cur = &g;
+    vec<int>      n2c;
+    double        q   = 0;
+
+    for (;;) {
+        double nq;
+        if (!localMoving(*cur, n2c, min_gain, nq)) {
+            if (cur == &g) q = nq;
+            break;
+        }
+        q = nq;
+
+        int k = renumberCommunities(n2c);
+        for (int v = 0; v < n; v++) cmty[v] = n2c[cmty[v]];
+        if (k == cur->nNodes()) break;
+
+        WGraph next;
+        aggregate(*cur, n2c, k, next);
+        next.moveTo(level);
+        cur = &level;
+    }
+
+    renumberCommunities(cmty);
+    return q;
+}
+
+//=================================================================================================
+// Label propagation:
+
+// Modularity of the current labels. Per-node internal weights are computed in parallel, the
+// per-label totals sequentially (labels are node ids, so 'tot' is indexed by node).
+static double labelModularity(const WGraph& g, const std::atomic<int>* label, const vec<double>& str, double m2,
+                              int nthreads, vec<double>& inw, vec<double>& tot)
+{
+    int n = g.nNodes();
+    if (m2 <= 0) return 0;
+    runThreads(nthreads, [&](int t) {
+        for (int v = t; v < n; v += nthreads) {
+            int    l = label[v].load(std::memory_order_relaxed);
+            double w = 0;
+            for (int e = g.start[v]; e < g.start[v + 1]; e++)
+                if (label[g.adj[e]].load(std::memory_order_relaxed) == l) w += g.weight[e];
+            inw[v] = w;
+        }
+    });
+
+    double in = 0, sq = 0;
+    for (int v = 0; v < n; v++) tot[v] = 0;
+    for (int v = 0; v < n; v++) {
+        in += inw[v];
+        tot[label[v].load(std::memory_order_relaxed)] += str[v];
+    }
+    for (int v = 0; v < n; v++) sq += tot[v] * tot[v];
+    return in / m2 - sq / (m2 * m2);
+}
+
+double Glucose::labelPropagation(const WGraph& g, vec<int>& cmty, int nthreads, double time_limit, int max_iters)
+{
+    const int chunk    = 4096;
+    int       n        = g.nNodes();
+    double    deadline = time_limit > 0 ? realTime() + time_limit : HUGE_VAL;
+    nthreads = effectiveThreads(nthreads);
+
+    std::atomic<int>*  label  = new std::atomic<int> [n];
+    std::atomic<char>* active = new std::atomic<char>[n];
+    vec<double>        str(n), inw(n), tot(n);
+    double             m2 = 0;
+    for (int v = 0; v < n; v++) {
+        str[v] = g.strength(v);
+        m2    += str[v];
+        label[v].store(v, std::memory_order_relaxed);
+        active[v].store(g.degree(v) > 0, std::memory_order_relaxed);
+    }
+
+    cmty.clear();
+    cmty.growTo(n);
+    for (int v = 0; v < n; v++) cmty[v] = v;
+    double bestQ = labelModularity(g, label, str, m2, nthreads, inw, tot);
+
+    std::atomic<bool> timeout(false);
+    for (int iter = 0; iter < max_iters && !timeout; iter++) {
+        std::atomic<int> next(0), updated(0);
+
+        runThreads(nthreads, [&](int t) {
+            SparseAccumulator acc;
+            uint64_t          rnd   = 0x9E3779B97F4A7C15ULL * (uint64_t)(t + 1) ^ (uint64_t)(iter + 1);
+            int               local = 0;
+            for (;;) {
+                int from = next.fetch_add(chunk);
+                if (from >= n) break;
+                if (realTime() > deadline) { timeout = true; break; }
+                int to = from + chunk < n ? from + chunk : n;
+
+                for (int v = from; v < to; v++) {
+                    if (!active[v].load(std::memory_order_relaxed)) continue;
+                    active[v].store(0, std::memory_order_relaxed);
+
+                    acc.clear();
+                    for (int e = g.start[v]; e < g.start[v + 1]; e++)
+                        if (g.adj[e] != v)
+                            acc.add(label[g.adj[e]].load(std::memory_order_relaxed), g.weight[e]);
+                    if (acc.size() == 0) continue;
+
+                    // Heaviest neighbouring label; ties are broken at random, but the current
+                    // label is kept whenever it is among the heaviest ones.
+                    int    cur   = label[v].load(std::memory_order_relaxed);
+                    int    best  = cur;
+                    double maxW  = -1;
+                    int    nties = 0;
+                    for (int k = 0; k < acc.size(); k++) {
+                        double w = acc.value(k);
+                        if (w > maxW) {
+                            maxW  = w;
+                            best  = acc.key(k);
+                            nties = 1;
+                        } else if (w == maxW) {
+                            rnd ^= rnd << 13; rnd ^= rnd >> 7; rnd ^= rnd << 17;
+                            if (rnd % ++nties == 0) best = acc.key(k);
+                        }
+                    }
+                    if (acc.get(cur) == maxW) best = cur;
+
+                    if (best != cur) {
+                        label[v].store(best, std::memory_order_relaxed);
+                        local++;
+                        for (int e = g.start[v]; e < g.start[v + 1]; e++)
+                            active[g.adj[e]].store(1, std::memory_order_relaxed);
+                    }
+                }
+            }
+            updated += local;
+        });
+
+        // Keep the best labelling seen so far (also after an interrupted sweep):
+        double q = labelModularity(g, label, str, m2, nthreads, inw, tot);
+        if (q > bestQ) {
+            bestQ = q;
+            for (int v = 0; v < n; v++) cmty[v] = label[v].load(std::memory_order_relaxed);
+        }
+        if (updated <= n / 100000) break;
+    }
+
+    delete [] label;
+    delete [] active;
+    renumberCommunities(cmty);
+    return bestQ;
+}
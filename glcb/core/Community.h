@@ -0,0 +1,45 @@
+/************************************************************************************[Community.h]
+ In-process community detection on the variable incidence graph (see core/Graph.h).
+
+ Same licence as the rest of Glucose (see LICENCE).
+ **************************************************************************************************/
+
+#ifndef Glucose_Community_h
+#define Glucose_Community_h
+
+#include "mtl/Vec.h"
+#include "core/Graph.h"
+
+namespace Glucose {
+
+//=================================================================================================
+// Louvain modularity optimisation (Blondel et al., 2008):
+//
+// Fills 'cmty[v]' with a community id for every node of 'g'. Ids are contiguous, start at 0 and
+// are numbered in order of the first node of each community. Returns the modularity of the
+// partition found.
+
+double louvain(const WGraph& g, vec<int>& cmty, double min_gain = 1e-6);
+
+// Modularity of the partition 'cmty' of 'g'.
+double modularity(const WGraph& g, const vec<int>& cmty);
+
+// Renumbers 'cmty' with contiguous ids in order of first occurrence. Returns the number of ids.
+int renumberCommunities(vec<int>& cmty);
+
+
+//=================================================================================================
+// Parallel label propagation (Raghavan et al., 2007), for graphs too large for Louvain:
+//
+// Asynchronous weighted label propagation; 'nthreads' workers pull chunks of nodes from a shared
+// counter and only revisit nodes whose neighbourhood changed. Sweeps stop when almost no label
+// changes, after 'max_iters' sweeps, or as soon as 'time_limit' seconds of wall time have elapsed
+// (a non positive limit means no limit). The labelling with the best modularity seen after any
+// sweep is returned in 'cmty' (renumbered as for 'louvain') together with its modularity.
+
+double labelPropagation(const WGraph& g, vec<int>& cmty, int nthreads, double time_limit, int max_iters = 100);
+
+//=================================================================================================
+}
+
+#endif
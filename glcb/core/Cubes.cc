@@ -0,0 +1,254 @@
+/***************************************************************************************[Cubes.cc]
+ Same licence as the rest of Glucose (see LICENCE).
+ **************************************************************************************************/
+
+#include "mtl/Sort.h"
+#include "core/Cubes.h"
+#include "utils/System.h"
+#include "utils/Threads.h"
+
+using namespace Glucose;
+
+//=================================================================================================
+// CubeWorker -- a clone of the master solving cubes and sharing its learnt units:
+
+namespace Glucose {
+
+class CubeWorker : public Solver {
+    CubeAndConquer& cc;
+    int             id;
+    vec<uint64_t>   cursor;    // Read position in the ring of every thread.
+    vec<Lit>        tmp;
+
+public:
+    CubeWorker(const Solver& s, CubeAndConquer& c, int i);
+
+    virtual bool parallelJobIsFinished();
+    virtual bool parallelImportClauses();
+    virtual void parallelExportUnaryClause(Lit p);
+};
+
+}
+
+CubeWorker::CubeWorker(const Solver& s, CubeAndConquer& c, int i) :
+    Solver(s), cc(c), id(i), cursor(c.nThreads, 0)
+{
+    verbosity     = 0;
+    searchThreads = 1;
+    cubeDepth     = 0;
+    for (int r = 0; r < cc.nThreads; r++) cursor[r] = cc.rings[r].end();
+}
+
+bool CubeWorker::parallelJobIsFinished() {
+    if (!cc.interrupted()) return false;
+    interrupt();    // Makes 'solve_' leave its restart loop.
+    return true;
+}
+
+void CubeWorker::parallelExportUnaryClause(Lit p) {
+    cc.rings[id].push(&p, 1, 1); }
+
+// Called at decision level 0: returns TRUE if a unit of another thread contradicts the root facts.
+bool CubeWorker::parallelImportClauses() {
+    int lbd;
+    for (int r = 0; r < cc.nThreads; r++) {
+        if (r == id) continue;
+        while (cc.rings[r].pop(cursor[r], tmp, lbd)) {
+            if (value(tmp[0]) == l_False) return true;
+            if (value(tmp[0]) == l_Undef) uncheckedEnqueue(tmp[0]);
+        }
+    }
+    return false;
+}
+
+
+//=================================================================================================
+// Cube generation:
+
+CubeAndConquer::CubeAndConquer(Solver& m, int nthreads, int d, int maxc) :
+    master(m), nThreads(nthreads), depth(d), maxCands(maxc)
+  , rings(new ClauseRing[nthreads]), deques(new CubeDeque[nthreads]), winner(-1), stop(false), incomplete(false)
+  , nCubes(0), nRefuted(0), nSolved(0), cubeTime(0)
+{ }
+
+CubeAndConquer::~CubeAndConquer() {
+    delete [] rings;
+    delete [] deques; }
+
+bool CubeAndConquer::interrupted() const {
+    return stop.load(std::memory_order_relaxed) || master.interrupted(); }
+
+// Bridges that are high centers first, then high centers, then bridges; by centrality within each.
+struct CandLt {
+    const vec<bool>&   bridges;
+    const vec<bool>&   highcenter;
+    const vec<double>& centrality;
+    CandLt(const vec<bool>& b, const vec<bool>& h, const vec<double>& c)
+        : bridges(b), highcenter(h), centrality(c) { }
+    int rank(Var v) const { return (highcenter[v] ? 2 : 0) + (bridges[v] ? 1 : 0); }
+    bool operator () (Var x, Var y) const {
+        return rank(x) > rank(y) || (rank(x) == rank(y) && centrality[x] > centrality[y]); }
+};
+
+int CubeAndConquer::probe(Lit l)
+{
+    int before = master.trail.size();
+    master.newDecisionLevel();
+    master.uncheckedEnqueue(l);
+    bool conflict = master.propagate() != CRef_Undef;
+    int  implied  = master.trail.size() - before;
+    master.cancelUntil(master.decisionLevel() - 1);
+    return conflict ? -1 : implied;
+}
+
+bool CubeAndConquer::force(Lit l, vec<Lit>& cube, bool fact)
+{
+    if (fact) {
+        master.uncheckedEnqueue(l);
+        return master.propagate() == CRef_Undef; }
+    master.newDecisionLevel();
+    master.uncheckedEnqueue(l);
+    cube.push(l);
+    return master.propagate() == CRef_Undef;
+}
+
+void CubeAndConquer::split(vec<Lit>& cube, int d)
+{
+    if (interrupted()) { incomplete = true; return; }
+    int level = master.decisionLevel();
+    int size  = cube.size();
+
+    Var    best  = var_Undef;
+    double score = -1;
+    for (int i = 0; d > 0 && i < cands.size(); i++) {
+        Var v = cands[i];
+        if (master.value(v) != l_Undef) continue;
+        int pos = probe(mkLit(v, false));
+        int neg = probe(mkLit(v, true));
+        if (pos < 0 || neg < 0) {
+            // Failed literal: its negation holds in the whole subtree (at the root, for good).
+            bool root = master.decisionLevel() == 0;
+            if (pos >= 0 || neg >= 0)
+                if (force(mkLit(v, neg >= 0), cube, root)) continue;
+            if (root) master.ok = false;
+            else      nRefuted++;
+            goto done; }
+        double s = (1.0 + pos) * (1.0 + neg);
+        if (s > score) score = s, best = v;
+    }
+
+    if (best == var_Undef) {
+        for (int i = 0; i < cube.size(); i++) cubeLits.push(cube[i]);
+        cubeLits.push(lit_Undef);
+        nCubes++;
+    } else
+        for (int s = 0; s < 2 && master.ok; s++) {
+            int lev = master.decisionLevel(), sz = cube.size();
+            if (force(mkLit(best, s == 1), cube, false))
+                split(cube, d - 1);
+            else
+                nRefuted++;
+            master.cancelUntil(lev);
+            cube.shrink(cube.size() - sz);
+        }
+
+done:
+    master.cancelUntil(level);
+    cube.shrink(cube.size() - size);
+}
+
+lbool CubeAndConquer::generate()
+{
+    for (Var v = 0; v < master.nVars(); v++)
+        if (master.decision[v] && master.value(v) == l_Undef && (master.bridges[v] || master.highcenter[v]))
+            cands.push(v);
+    sort(cands, CandLt(master.bridges, master.highcenter, master.centrality));
+    if (cands.size() > maxCands) cands.shrink(cands.size() - maxCands);
+
+    vec<Lit> cube;
+    split(cube, depth);
+    master.cancelUntil(0);
+    for (int i = 0; i < cubeLits.size(); i++)
+        if (i == 0 || cubeLits[i - 1] == lit_Undef) cubeStart.push(i);
+    return !master.ok ? l_False : incomplete ? l_Undef : l_True;
+}
+
+void CubeAndConquer::cube(int c, vec<Lit>& out) const
+{
+    out.clear();
+    for (int i = cubeStart[c]; cubeLits[i] != lit_Undef; i++) out.push(cubeLits[i]);
+}
+
+
+//=================================================================================================
+// Conquering:
+
+bool CubeAndConquer::next(int t, int& cube)
+{
+    for (int i = 0; i < nThreads; i++) {
+        CubeDeque& dq = deques[(t + i) % nThreads];
+        std::lock_guard<std::mutex> lock(dq.m);
+        if (dq.head == dq.cubes.size()) continue;
+        if (i == 0) {
+            cube = dq.cubes.last();         // Own deque: newest first.
+            dq.cubes.pop();
+        } else
+            cube = dq.cubes[dq.head++];     // Steal the oldest.
+        if (dq.head == dq.cubes.size()) dq.cubes.clear(), dq.head = 0;
+        return true;
+    }
+    return false;
+}
+
+lbool CubeAndConquer::solve()
+{
+    double start = realTime();
+    lbool gen = generate();
+    if (gen != l_True) return gen;
+
+    for (int c = 0; c < cubeStart.size(); c++)
+        deques[c % nThreads].cubes.push(c);
+    cubeTime = realTime() - start;
+
+    lbool             result = l_Undef;
+    vec<lbool>        model;
+    std::atomic<int>  solved(0);
+    vec<uint64_t>     conflicts(nThreads, 0), decisions(nThreads, 0), propagations(nThreads, 0);
+
+    runThreads(nThreads, [&](int t) {
+        CubeWorker w(master, *this, t);
+        vec<Lit>   as;
+        int        c;
+        uint64_t   c0 = w.conflicts, d0 = w.decisions, p0 = w.propagations;
+        while (!interrupted() && next(t, c)) {
+            cube(c, as);
+            lbool r = w.solveLimited(as);
+            if (r == l_Undef) break;
+            if (r == l_False && w.conflict.size() > 0) {
+                solved++;
+                continue; }
+
+            // A model, or UNSAT without assumptions involved: the answer for the whole formula.
+            int none = -1;
+            if (winner.compare_exchange_strong(none, t)) {
+                stop.store(true);
+                result = r;
+                w.model.copyTo(model);
+            }
+        }
+        conflicts[t]    = w.conflicts - c0;
+        decisions[t]    = w.decisions - d0;
+        propagations[t] = w.propagations - p0;
+    });
+
+    for (int t = 0; t < nThreads; t++) {
+        master.conflicts    += conflicts[t];
+        master.decisions    += decisions[t];
+        master.propagations += propagations[t];
+    }
+    nSolved = solved;
+    // UNSAT only if every cube of the complete tree was refuted:
+    if (result == l_Undef && nSolved == cubeStart.size()) result = l_False;
+    model.copyTo(master.model);
+    return result;
+}
@@ -0,0 +1,86 @@
+/****************************************************************************************[Cubes.h]
+ Cube-and-conquer search splitting on the bridge and high centrality variables.
+
+ Same licence as the rest of Glucose (see LICENCE).
+ **************************************************************************************************/
+
+#ifndef Glucose_Cubes_h
+#define Glucose_Cubes_h
+
+#include <atomic>
+#include <mutex>
+#include <stdint.h>
+
+#include "mtl/Vec.h"
+#include "core/Solver.h"
+#include "core/Portfolio.h"
+
+namespace Glucose {
+
+//=================================================================================================
+// CubeAndConquer -- cube generation by lookahead, then parallel solving of the cubes:
+//
+// Cubing runs on 'master' (at decision level 0, metadata initialised). Split candidates are the
+// unassigned decision variables that are both bridges and high centers, completed by the other
+// high centers and bridges up to 'maxCands', by decreasing centrality. At every node of the cube
+// tree, each candidate 'v' is probed both ways by unit propagation and the one maximising
+// (1 + #implied by v) * (1 + #implied by ~v) is split on; failed literals are forced, and branches
+// that fail both ways are refuted without search. Failed literals at the root become facts of
+// 'master'. The tree stops at depth 'depth'.
+//
+// 'generate' alone gives the cubes to solve elsewhere (see 'solveDistributed' in simp/Distributed.h).
+// Conquering uses 'nthreads' clones of 'master', each solving cubes as assumptions with
+// 'solveLimited' and keeping its learnt clauses from cube to cube. Cubes are dealt round-robin
+// into one deque per thread; a thread takes from the back of its own deque and steals from the
+// front of the others. Learnt units are shared through one ClauseRing per thread. The first SAT
+// cube (or a proof that the formula itself is UNSAT) cancels every remaining cube.
+
+class CubeAndConquer {
+    struct CubeDeque {
+        std::mutex m;
+        vec<int>   cubes;
+        int        head;
+        CubeDeque() : head(0) { }
+    };
+
+    Solver&            master;
+    int                nThreads;
+    int                depth;
+    int                maxCands;
+    ClauseRing*        rings;
+    CubeDeque*         deques;
+    std::atomic<int>   winner;
+    std::atomic<bool>  stop;
+
+    vec<Var>           cands;
+    vec<Lit>           cubeLits;     // All cubes, each followed by lit_Undef.
+    vec<int>           cubeStart;
+    bool               incomplete;   // 'split' was interrupted: the cubes do not cover the formula.
+
+    friend class CubeWorker;
+    bool interrupted() const;
+    bool next(int t, int& cube);
+
+    int  probe(Lit l);                              // Literals implied by 'l' on 'master', -1 on conflict.
+    bool force(Lit l, vec<Lit>& cube, bool fact);  // Assign 'l' as a root fact or on a new level of the cube.
+    void split(vec<Lit>& cube, int d);
+
+public:
+    CubeAndConquer(Solver& master, int nthreads, int depth, int maxCands);
+    ~CubeAndConquer();
+
+    lbool generate();                          // Cubing only: l_False if the formula was refuted,
+                                               // l_Undef if interrupted (the cubes are partial).
+    int   cubes() const { return cubeStart.size(); }
+    void  cube(int c, vec<Lit>& out) const;    // Literals of cube 'c' (after 'generate').
+    lbool solve();                             // Cubing then conquering (l_Undef if interrupted).
+
+    // Statistics:
+    int      nCubes, nRefuted, nSolved;
+    double   cubeTime;
+};
+
+//=================================================================================================
+}
+
+#endif
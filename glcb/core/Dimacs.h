@@ -0,0 +1,257 @@
+/****************************************************************************************[Dimacs.h]
+Copyright (c) 2003-2006, Niklas Een, Niklas Sorensson
+Copyright (c) 2007-2010, Niklas Sorensson
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or
+substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+**************************************************************************************************/
+
+#ifndef Glucose_Dimacs_h
+#define Glucose_Dimacs_h
+
+#include <stdio.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "utils/ParseUtils.h"
+#include "utils/Threads.h"
+#include "core/SolverTypes.h"
+
+namespace Glucose {
+
+//=================================================================================================
+// DIMACS Parser:
+
+// Literal stream of a parsed file, kept for -shm (see core/SharedFormula.h): every clause
+// terminated by 0, in file order, with the numbers of the "p cnf" header.
+struct DimacsImage {
+    vec<int> lits;
+    int      vars;
+    int      clauses;
+    DimacsImage() : vars(0), clauses(0) { }
+};
+
+template<class B, class Solver>
+static void readClause(B& in, Solver& S, vec<Lit>& lits) {
+    int     parsed_lit, var;
+    lits.clear();
+    for (;;){
+        parsed_lit = parseInt(in);
+        if (parsed_lit == 0) break;
+        var = abs(parsed_lit)-1;
+        while (var >= S.nVars()) S.newVar();
+        lits.push( (parsed_lit > 0) ? mkLit(var) : ~mkLit(var) );
+    }
+}
+
+template<class B, class Solver>
+static void parse_DIMACS_main(B& in, Solver& S, DimacsImage* keep = NULL) {
+    vec<Lit> lits;
+    int vars    = 0;
+    int clauses = 0;
+    int cnt     = 0;
+    for (;;){
+        skipWhitespace(in);
+        if (*in == EOF) break;
+        else if (*in == 'p'){
+            if (eagerMatch(in, "p cnf")){
+                vars    = parseInt(in);
+                clauses = parseInt(in);
+                S.initNbInitialClauses(clauses);
+                if (keep != NULL) keep->vars = vars, keep->clauses = clauses;
+                // SATRACE'06 hack
+                // if (clauses > 4000000)
+                //     S.eliminate(true);
+            }else{
+                printf("PARSE ERROR! Unexpected char: %c\n", *in), exit(3);
+            }
+        } else if (*in == 'c' || *in == 'p')
+            skipLine(in);
+        else{
+            cnt++;
+            readClause(in, S, lits);
+            if (keep != NULL) {
+                for (int i = 0; i < lits.size(); i++)
+                    keep->lits.push(sign(lits[i]) ? -(var(lits[i]) + 1) : var(lits[i]) + 1);
+                keep->lits.push(0); }
+            S.addClause_(lits); }
+    }
+    if (vars != S.nVars())
+        fprintf(stderr, "WARNING! DIMACS header mismatch: wrong number of variables.\n");
+    if (cnt  != clauses)
+        fprintf(stderr, "WARNING! DIMACS header mismatch: wrong number of clauses.\n");
+}
+
+// Inserts problem into solver.
+//
+template<class Solver>
+static void parse_DIMACS(gzFile input_stream, Solver& S, DimacsImage* keep = NULL) {
+    StreamBuffer in(input_stream);
+    parse_DIMACS_main(in, S, keep); }
+
+// Adds the clauses of the literal stream 'data' (every clause terminated by 0), creating the
+// variables as they first appear; a clause left open at the end stays in 'lits'. Returns the
+// number of clauses added.
+template<class Solver>
+static int addDimacsLits(const int* data, uint64_t n, Solver& S, vec<Lit>& lits) {
+    int cnt = 0;
+    for (uint64_t i = 0; i < n; i++)
+        if (data[i] == 0){
+            cnt++;
+            S.addClause_(lits);
+            lits.clear();
+        }else{
+            int var = abs(data[i]) - 1;
+            while (var >= S.nVars()) S.newVar();
+            lits.push(data[i] > 0 ? mkLit(var) : ~mkLit(var)); }
+    return cnt;
+}
+
+// Inserts a formula parsed before, from its literal stream (see 'DimacsImage').
+template<class Solver>
+static void parse_DIMACS_image(const int* data, uint64_t n, int vars, int clauses, Solver& S) {
+    S.initNbInitialClauses(clauses);
+    vec<Lit> lits;
+    int      cnt = addDimacsLits(data, n, S, lits);
+    if (lits.size() > 0)
+        fprintf(stderr, "PARSE ERROR! Unexpected char: %c\n", EOF), exit(3);
+    if (vars != S.nVars())
+        fprintf(stderr, "WARNING! DIMACS header mismatch: wrong number of variables.\n");
+    if (cnt  != clauses)
+        fprintf(stderr, "WARNING! DIMACS header mismatch: wrong number of clauses.\n");
+}
+
+
+//=================================================================================================
+// Parallel parser for uncompressed files:
+//
+// The file is memory-mapped and cut into one chunk per thread at line starts. Each thread turns
+// its chunk into a flat buffer of DIMACS literals with 0 terminators; a clause crossing a chunk
+// boundary is simply continued by the next buffer, so the buffers concatenated in order are the
+// literal stream of the whole file. The clauses are then added in file order, variables being
+// created as they first appear exactly as in 'parse_DIMACS' (the order matters to the simplifier).
+
+struct DimacsChunk {
+    vec<int> lits;       // Literals of the chunk, every clause terminated by 0.
+    int      vars;       // Header of the chunk if any ('vars' is -1 otherwise).
+    int      clauses;
+    bool     failed;     // Parse error at character 'error'.
+    int      error;
+    DimacsChunk() : vars(-1), clauses(0), failed(false), error(0) { }
+};
+
+static inline bool parseChunkInt(const char*& p, const char* end, int& val, DimacsChunk& ch) {
+    bool neg = false;
+    val = 0;
+    while (p < end && ((*p >= 9 && *p <= 13) || *p == 32)) p++;
+    if      (p < end && *p == '-') neg = true, p++;
+    else if (p < end && *p == '+') p++;
+    if (p >= end || *p < '0' || *p > '9') {
+        ch.failed = true, ch.error = p < end ? (unsigned char)*p : EOF;
+        return false; }
+    while (p < end && *p >= '0' && *p <= '9')
+        val = val*10 + (*p - '0'), p++;
+    if (neg) val = -val;
+    return true;
+}
+
+static inline void parseChunk(const char* p, const char* end, DimacsChunk& ch) {
+    static const char* header = "p cnf";
+    for (;;){
+        while (p < end && ((*p >= 9 && *p <= 13) || *p == 32)) p++;
+        if (p >= end) return;
+        if (*p == 'p'){
+            for (const char* h = header; *h != '\0'; h++, p++)
+                if (p >= end || *p != *h) {
+                    ch.failed = true, ch.error = p < end ? (unsigned char)*p : EOF;
+                    return; }
+            if (!parseChunkInt(p, end, ch.vars, ch) || !parseChunkInt(p, end, ch.clauses, ch)) return;
+        } else if (*p == 'c'){
+            while (p < end && *p != '\n') p++;
+        } else{
+            int lit;
+            if (!parseChunkInt(p, end, lit, ch)) return;
+            ch.lits.push(lit);
+        }
+    }
+}
+
+// Parses the plain DIMACS file 'path' with 'nthreads' threads (0 = one per core). Returns FALSE,
+// without touching 'S', if the file cannot be mapped or is gzipped: use 'parse_DIMACS' then.
+template<class Solver>
+static bool parse_DIMACS_mmap(const char* path, Solver& S, int nthreads, DimacsImage* keep = NULL) {
+    const size_t min_chunk = 1 << 20;
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return false;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || st.st_size < 2) {
+        close(fd);
+        return false; }
+    size_t      size = st.st_size;
+    const char* data = (const char*)mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) return false;
+    if ((unsigned char)data[0] == 0x1f && (unsigned char)data[1] == 0x8b) {
+        munmap((void*)data, size);
+        return false; }
+
+    nthreads = effectiveThreads(nthreads);
+    if ((size_t)nthreads > size / min_chunk) nthreads = size / min_chunk > 0 ? size / min_chunk : 1;
+    vec<size_t> bound(nthreads + 1, size);
+    bound[0] = 0;
+    for (int t = 1; t < nthreads; t++){
+        size_t b = size / nthreads * t;
+        if (b < bound[t - 1]) b = bound[t - 1];
+        while (b < size && data[b - 1] != '\n') b++;
+        bound[t] = b; }
+
+    DimacsChunk* chunks = new DimacsChunk[nthreads];
+    runThreads(nthreads, [&](int t) { parseChunk(data + bound[t], data + bound[t + 1], chunks[t]); });
+    munmap((void*)data, size);
+
+    int vars = 0, clauses = 0;
+    for (int t = 0; t < nthreads; t++){
+        if (chunks[t].failed)
+            fprintf(stderr, "PARSE ERROR! Unexpected char: %c\n", chunks[t].error), exit(3);
+        if (chunks[t].vars >= 0) vars = chunks[t].vars, clauses = chunks[t].clauses; }
+    S.initNbInitialClauses(clauses);
+    if (keep != NULL) keep->vars = vars, keep->clauses = clauses;
+
+    vec<Lit> lits;
+    int      cnt = 0;
+    for (int t = 0; t < nthreads; t++){
+        vec<int>& buf = chunks[t].lits;
+        cnt += addDimacsLits((const int*)buf, buf.size(), S, lits);
+        if (keep != NULL)
+            for (int i = 0; i < buf.size(); i++) keep->lits.push(buf[i]);
+        buf.clear(true);
+    }
+    delete [] chunks;
+    if (lits.size() > 0)
+        fprintf(stderr, "PARSE ERROR! Unexpected char: %c\n", EOF), exit(3);
+
+    if (vars != S.nVars())
+        fprintf(stderr, "WARNING! DIMACS header mismatch: wrong number of variables.\n");
+    if (cnt  != clauses)
+        fprintf(stderr, "WARNING! DIMACS header mismatch: wrong number of clauses.\n");
+    return true;
+}
+
+//=================================================================================================
+}
+
+#endif
@@ -0,0 +1,162 @@
+/***************************************************************************************[Graph.cc]
+ Same licence as the rest of Glucose (see LICENCE).
+ **************************************************************************************************/
+
+#include "core/Graph.h"
+#include "utils/Threads.h"
+
+using namespace Glucose;
+
+//=================================================================================================
+// WGraph:
+
+double WGraph::strength(int v) const {
+    double s = 0;
+    for (int e = start[v]; e < start[v+1]; e++)
+        s += weight[e];
+    return s;
+}
+
+double WGraph::selfLoop(int v) const {
+    for (int e = start[v]; e < start[v+1]; e++)
+        if (adj[e] == v) return weight[e];
+    return 0;
+}
+
+//=================================================================================================
+// Variable incidence graph:
+//
+// Rows are produced one variable at a time by walking the clauses the variable occurs in and
+// accumulating neighbour weights in a sparse accumulator, so duplicate edges are merged without
+// any sorting. Each thread owns a contiguous range of variables holding about the same number of
+// occurrences, writes its rows to private buffers, and the buffers are then copied into place.
+
+static void buildRows(const ClauseAllocator& ca, const vec<CRef>& cs, const vec<int>& ostart, const vec<int>& occ,
+                      Var from, Var to, vec<int>& rowlen, vec<int>& adj, vec<double>& weight)
+{
+    SparseAccumulator acc;
+    for (Var v = from; v < to; v++) {
+        acc.clear();
+        for (int o = ostart[v]; o < ostart[v + 1]; o++) {
+            const Clause& c = ca[cs[occ[o]]];
+            if (c.size() < 2) continue;
+            double w = 2.0 / ((double)c.size() * (c.size() - 1));
+            for (int j = 0; j < c.size(); j++)
+                if (var(c[j]) != v) acc.add(var(c[j]), w);
+        }
+        for (int k = 0; k < acc.size(); k++) {
+            adj.push(acc.key(k));
+            weight.push(acc.value(k));
+        }
+        rowlen[v + 1] = acc.size();
+    }
+}
+
+void Glucose::buildVarGraph(const ClauseAllocator& ca, const vec<CRef>& cs, int nvars, WGraph& g, int nthreads)
+{
+    // Occurrence lists (variable -> clause index) in CSR form:
+    vec<int> ostart(nvars + 1, 0);
+    for (int i = 0; i < cs.size(); i++) {
+        const Clause& c = ca[cs[i]];
+        for (int j = 0; j < c.size(); j++)
+            ostart[var(c[j]) + 1]++;
+    }
+    for (int v = 0; v < nvars; v++) ostart[v + 1] += ostart[v];
+
+    vec<int> occ(ostart[nvars]);
+    vec<int> fill(nvars, 0);
+    for (int i = 0; i < cs.size(); i++) {
+        const Clause& c = ca[cs[i]];
+        for (int j = 0; j < c.size(); j++) {
+            Var v = var(c[j]);
+            occ[ostart[v] + fill[v]++] = i;
+        }
+    }
+    fill.clear(true);
+
+    // Split the variables in ranges of similar work:
+    if (nthreads < 1) nthreads = 1;
+    if (nthreads > nvars) nthreads = nvars > 0 ? nvars : 1;
+    vec<int> bound(nthreads + 1, nvars);
+    bound[0] = 0;
+    for (int t = 1, v = 0; t < nthreads; t++) {
+        int64_t target = (int64_t)ostart[nvars] * t / nthreads;
+        while (v < nvars && ostart[v] < target) v++;
+        bound[t] = v;
+    }
+
+    g.clear();
+    g.start.growTo(nvars + 1, 0);
+    vec<int>    *adj    = new vec<int>   [nthreads];
+    vec<double> *weight = new vec<double>[nthreads];
+
+    runThreads(nthreads, [&](int t) {
+        buildRows(ca, cs, ostart, occ, bound[t], bound[t + 1], g.start, adj[t], weight[t]);
+    });
+
+    for (int v = 0; v < nvars; v++) g.start[v + 1] += g.start[v];
+    g.adj.growTo(g.start[nvars]);
+    g.weight.growTo(g.start[nvars]);
+
+    runThreads(nthreads, [&](int t) {
+        int base = g.start[bound[t]];
+        if (adj[t].size() > 0) {
+            memcpy(&g.adj[base], (int*)adj[t], sizeof(int) * adj[t].size());
+            memcpy(&g.weight[base], (double*)weight[t], sizeof(double) * weight[t].size());
+        }
+        adj[t].clear(true);
+        weight[t].clear(true);
+    });
+
+    delete [] adj;
+    delete [] weight;
+}
+
+//=================================================================================================
+// Community graph:
+
+void Glucose::buildCommunityGraph(const ClauseAllocator& ca, const vec<CRef>& cs, const vec<int>& cmty, int k, WGraph& g)
+{
+    // Distinct communities of every clause, in CSR form:
+    vec<int> cstart(cs.size() + 1, 0);
+    vec<int> ccmty;
+    vec<int> mark(k, -1);
+    for (int i = 0; i < cs.size(); i++) {
+        const Clause& c = ca[cs[i]];
+        for (int j = 0; j < c.size(); j++) {
+            int d = cmty[var(c[j])];
+            if (mark[d] != i) {
+                mark[d] = i;
+                ccmty.push(d);
+            }
+        }
+        cstart[i + 1] = ccmty.size();
+    }
+
+    // Clauses spanning each community and at least one other:
+    vec<int> ostart(k + 1, 0);
+    for (int i = 0; i < cs.size(); i++)
+        if (cstart[i + 1] - cstart[i] > 1)
+            for (int j = cstart[i]; j < cstart[i + 1]; j++) ostart[ccmty[j] + 1]++;
+    for (int d = 0; d < k; d++) ostart[d + 1] += ostart[d];
+    vec<int> occ(ostart[k]);
+    vec<int> fill(k, 0);
+    for (int i = 0; i < cs.size(); i++)
+        if (cstart[i + 1] - cstart[i] > 1)
+            for (int j = cstart[i]; j < cstart[i + 1]; j++) occ[ostart[ccmty[j]] + fill[ccmty[j]]++] = i;
+
+    g.clear();
+    g.start.growTo(k + 1, 0);
+    SparseAccumulator acc;
+    for (int d = 0; d < k; d++) {
+        acc.clear();
+        for (int o = ostart[d]; o < ostart[d + 1]; o++)
+            for (int j = cstart[occ[o]]; j < cstart[occ[o] + 1]; j++)
+                if (ccmty[j] != d) acc.add(ccmty[j], 1);
+        for (int e = 0; e < acc.size(); e++) {
+            g.adj.push(acc.key(e));
+            g.weight.push(acc.value(e));
+        }
+        g.start[d + 1] = g.adj.size();
+    }
+}
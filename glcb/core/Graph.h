@@ -0,0 +1,95 @@
+/****************************************************************************************[Graph.h]
+ Weighted variable incidence graph (VIG) built directly from the clause arena.
+
+ Every clause of size k contributes an edge of weight 1/C(k,2) between each pair of its
+ variables, so that each clause carries the same total weight whatever its length. The graph is
+ stored in compressed sparse row form: the neighbours of node 'v' are adj[start[v] .. start[v+1]).
+
+ Same licence as the rest of Glucose (see LICENCE).
+ **************************************************************************************************/
+
+#ifndef Glucose_Graph_h
+#define Glucose_Graph_h
+
+#include "mtl/Vec.h"
+#include "core/SolverTypes.h"
+
+namespace Glucose {
+
+//=================================================================================================
+// WGraph -- undirected weighted graph in CSR form:
+//
+// Each undirected edge appears in the rows of both end points. A self-loop (only produced when
+// a graph is aggregated by community) appears once, in the row of its node.
+
+class WGraph {
+public:
+    vec<int>    start;   // start[v] is the first index of the row of v (size = nNodes()+1).
+    vec<int>    adj;     // Neighbour of each entry.
+    vec<double> weight;  // Weight of each entry.
+
+    int     nNodes   ()      const { return start.size() == 0 ? 0 : start.size() - 1; }
+    int     nEntries ()      const { return adj.size(); }
+    int     degree   (int v) const { return start[v+1] - start[v]; }
+    double  strength (int v) const; // Sum of the weights of the row of v.
+    double  selfLoop (int v) const; // Weight of the self-loop of v (0 if none).
+    void    clear    ()            { start.clear(true); adj.clear(true); weight.clear(true); }
+    void    moveTo   (WGraph& to)  { start.moveTo(to.start); adj.moveTo(to.adj); weight.moveTo(to.weight); }
+};
+
+// Builds the variable incidence graph of the clauses 'cs' over 'nvars' variables. Rows are
+// computed by 'nthreads' threads working on disjoint variable ranges.
+void buildVarGraph(const ClauseAllocator& ca, const vec<CRef>& cs, int nvars, WGraph& g, int nthreads = 1);
+
+// Builds the community graph of a partition 'cmty' (variable -> id in [0,k)) of the variables of
+// 'cs': one node per community, and between two communities an edge whose weight is the number of
+// clauses containing variables of both.
+void buildCommunityGraph(const ClauseAllocator& ca, const vec<CRef>& cs, const vec<int>& cmty, int k, WGraph& g);
+
+
+//=================================================================================================
+// SparseAccumulator -- sums weights per node id, cleared in time proportional to its content:
+//
+// Open addressing with linear probing. Unlike a dense scratch array its memory does not depend on
+// the number of nodes, so every worker thread can own one.
+
+class SparseAccumulator {
+    vec<int>    keys;    // -1 marks an empty slot.
+    vec<double> vals;
+    vec<int>    used;    // Slots in use, in insertion order.
+    uint32_t    mask;
+
+    void rehash(int cap) {
+        vec<int> ok; vec<double> ov;
+        keys.moveTo(ok); vals.moveTo(ov);
+        keys.growTo(cap, -1); vals.growTo(cap, 0);
+        mask = cap - 1;
+        vec<int> ou; used.moveTo(ou);
+        for (int i = 0; i < ou.size(); i++) add(ok[ou[i]], ov[ou[i]]);
+    }
+
+public:
+    SparseAccumulator() : mask(0) { rehash(64); }
+
+    void add(int key, double w) {
+        if (2 * (used.size() + 1) > keys.size()) rehash(2 * keys.size());
+        uint32_t h = ((uint32_t)key * 2654435761u) & mask;
+        while (keys[h] != -1 && keys[h] != key) h = (h + 1) & mask;
+        if (keys[h] == -1) { keys[h] = key; vals[h] = 0; used.push(h); }
+        vals[h] += w;
+    }
+
+    int     size    ()      const { return used.size(); }
+    int     key     (int i) const { return keys[used[i]]; }
+    double  value   (int i) const { return vals[used[i]]; }
+    double  get     (int key) const {
+        uint32_t h = ((uint32_t)key * 2654435761u) & mask;
+        while (keys[h] != -1) { if (keys[h] == key) return vals[h]; h = (h + 1) & mask; }
+        return 0; }
+    void    clear   ()            { for (int i = 0; i < used.size(); i++) keys[used[i]] = -1; used.clear(); }
+};
+
+//=================================================================================================
+}
+
+#endif
@@ -0,0 +1,208 @@
+/************************************************************************************[Metadata.cc]
+ Same licence as the rest of Glucose (see LICENCE).
+ **************************************************************************************************/
+
+#include <atomic>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "core/Metadata.h"
+
+using namespace Glucose;
+
+static const char metaMagic[8] = { 'G', 'L', 'C', 'B', 'M', 'E', 'T', 'A' };
+
+// Byte offsets of the arrays of a file with 'nvars' variables and 'ncmtys' communities.
+static void layout(uint64_t nvars, uint64_t ncmtys, uint64_t& centr, uint64_t& cmty, uint64_t& numbr,
+                   uint64_t& bridge, uint64_t& size)
+{
+    centr  = sizeof(MetadataHeader);
+    cmty   = centr + sizeof(double) * (ncmtys + 1);
+    numbr  = cmty  + sizeof(int32_t) * nvars;
+    bridge = numbr + sizeof(int32_t) * nvars;
+    size   = bridge + nvars;
+}
+
+static void header(MetadataHeader& h, uint64_t key, int nvars, int ncmtys, uint64_t size)
+{
+    memset(&h, 0, sizeof(h));
+    memcpy(h.magic, metaMagic, sizeof(metaMagic));
+    h.version = Metadata::Version;
+    h.nVars   = nvars;
+    h.nCmtys  = ncmtys;
+    h.key     = key;
+    h.size    = size;
+}
+
+//=================================================================================================
+// Metadata:
+
+Metadata::Status Metadata::load(const char* path, uint64_t key, int nvars)
+{
+    close();
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return errno == ENOENT ? Missing : Invalid;
+    return map(fd, key, nvars);
+}
+
+Metadata::Status Metadata::attach(const char* name, uint64_t key, int nvars)
+{
+    close();
+    int fd = shm_open(name, O_RDONLY, 0);
+    if (fd < 0) return errno == ENOENT ? Missing : Invalid;
+    return map(fd, key, nvars);
+}
+
+// Maps the file or segment 'fd' (closed here) read-only and checks it.
+Metadata::Status Metadata::map(int fd, uint64_t key, int nvars)
+{
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (uint64_t)st.st_size < sizeof(MetadataHeader)) {
+        ::close(fd);
+        return Invalid; }
+
+    void* m = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (m == MAP_FAILED) return Invalid;
+
+    const MetadataHeader& h     = *(const MetadataHeader*)m;
+    uint64_t              magic = loadMagic(m);
+    std::atomic_thread_fence(std::memory_order_acquire);        // (see 'publish')
+    uint64_t centr, cmt, numbr, brg, size;
+    layout(h.nVars, h.nCmtys, centr, cmt, numbr, brg, size);
+
+    Status s = Loaded;
+    if (memcmp(&magic, metaMagic, sizeof(metaMagic)) != 0 || h.version != Version
+        || h.size != (uint64_t)st.st_size || size != (uint64_t)st.st_size)
+        s = Invalid;
+    else if (h.key != key || h.nVars != (uint32_t)nvars)
+        s = Stale;
+    else if (h.nCmtys > h.nVars)
+        s = Invalid;
+    else                                                        // Community ids index per-community arrays.
+        for (uint32_t v = 0; v < h.nVars && s == Loaded; v++) {
+            int32_t c = ((const int32_t*)((const char*)m + cmt))[v];
+            if (c < 0 || (uint32_t)c >= h.nCmtys) s = Invalid; }
+
+    if (s != Loaded) {
+        munmap(m, st.st_size);
+        return s; }
+
+    image          = m;
+    mapSize        = st.st_size;
+    nVars          = h.nVars;
+    nCmtys         = h.nCmtys;
+    cmtyCentrality = (const double*) ((const char*)m + centr);
+    cmty           = (const int32_t*)((const char*)m + cmt);
+    numBridges     = (const int32_t*)((const char*)m + numbr);
+    bridge         = (const uint8_t*)((const char*)m + brg);
+    return Loaded;
+}
+
+void Metadata::close()
+{
+    if (image != NULL) munmap(image, mapSize);
+    image   = NULL;
+    mapSize = 0;
+    nVars   = nCmtys = 0;
+    cmtyCentrality = NULL;
+    cmty = numBridges = NULL;
+    bridge = NULL;
+}
+
+bool Metadata::save(const char* path, uint64_t key, int nvars, int ncmtys, const double* cmtyCentrality,
+                    const int* cmty, const int* numBridges, const bool* bridge)
+{
+    uint64_t centr, cmt, numbr, brg, size;
+    layout(nvars, ncmtys, centr, cmt, numbr, brg, size);
+
+    MetadataHeader h;
+    header(h, key, nvars, ncmtys, size);
+
+    char* tmp = new char[strlen(path) + 5];
+    sprintf(tmp, "%s.tmp", path);
+    FILE* f  = fopen(tmp, "wb");
+    bool  ok = f != NULL;
+    if (ok) {
+        ok = fwrite(&h, sizeof(h), 1, f) == 1
+          && fwrite(cmtyCentrality, sizeof(double), ncmtys + 1, f) == (size_t)ncmtys + 1;
+        vec<int32_t> ints(nvars);
+        vec<uint8_t> bytes(nvars);
+        for (int v = 0; v < nvars; v++) ints[v] = cmty[v];
+        ok = ok && fwrite((int32_t*)ints, sizeof(int32_t), nvars, f) == (size_t)nvars;
+        for (int v = 0; v < nvars; v++) ints[v] = numBridges[v];
+        ok = ok && fwrite((int32_t*)ints, sizeof(int32_t), nvars, f) == (size_t)nvars;
+        for (int v = 0; v < nvars; v++) bytes[v] = bridge[v];
+        ok = ok && fwrite((uint8_t*)bytes, 1, nvars, f) == (size_t)nvars;
+        ok = fclose(f) == 0 && ok;
+        ok = ok && rename(tmp, path) == 0;
+        if (!ok) ::remove(tmp);
+    }
+    delete [] tmp;
+    return ok;
+}
+
+bool Metadata::publish(const char* name, uint64_t key, int nvars, int ncmtys, const double* cmtyCentrality,
+                       const int* cmty, const int* numBridges, const bool* bridge)
+{
+    uint64_t centr, cmt, numbr, brg, size;
+    layout(nvars, ncmtys, centr, cmt, numbr, brg, size);
+
+    int fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0644);
+    if (fd < 0) return false;
+    char* m = ftruncate(fd, size) == 0 ? (char*)mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0) : (char*)MAP_FAILED;
+    ::close(fd);
+    if (m == MAP_FAILED) {
+        shm_unlink(name);
+        return false; }
+
+    MetadataHeader h;
+    header(h, key, nvars, ncmtys, size);
+    memset(h.magic, 0, sizeof(h.magic));
+    memcpy(m, &h, sizeof(h));
+    memcpy(m + centr, cmtyCentrality, sizeof(double) * (ncmtys + 1));
+    for (int v = 0; v < nvars; v++) {
+        ((int32_t*)(m + cmt))  [v] = cmty[v];
+        ((int32_t*)(m + numbr))[v] = numBridges[v];
+        ((uint8_t*)(m + brg))  [v] = bridge[v]; }
+    std::atomic_thread_fence(std::memory_order_release);
+    storeMagic(m, metaMagic);
+    munmap(m, size);
+    return true;
+}
+
+//=================================================================================================
+// Content hash:
+
+uint64_t Glucose::hashClauses(const ClauseAllocator& ca, const vec<CRef>& cs, int nvars)
+{
+    uint64_t h = hashMix(0, nvars);
+    for (int i = 0; i < cs.size(); i++) {
+        const Clause& c = ca[cs[i]];
+        for (int j = 0; j < c.size(); j++)
+            h = hashMix(h, toInt(c[j]) + 1);
+        h = hashMix(h, 0);
+    }
+    return h;
+}
+
+uint64_t Glucose::hashFile(uint64_t h, const char* path)
+{
+    if (path == NULL) return hashMix(h, 0);
+    FILE* f = fopen(path, "rb");
+    if (f == NULL) return hashMix(h, 1);
+    uint64_t buf[8192], total = 0;
+    size_t   n;
+    while ((n = fread(buf, 1, sizeof(buf), f)) > 0) {
+        if (n % 8 != 0) memset((char*)buf + n, 0, 8 - n % 8);
+        for (size_t i = 0; i < (n + 7) / 8; i++) h = hashMix(h, buf[i]);
+        total += n;
+    }
+    fclose(f);
+    return hashMix(h, total + 2);
+}
@@ -0,0 +1,105 @@
+/*************************************************************************************[Metadata.h]
+ Binary container for the graph metadata of an instance (communities, community centralities,
+ bridges), replacing the text side files on repeated runs.
+
+ Layout (native endianness, version 'Metadata::Version'):
+
+     header     MetadataHeader                        (64 bytes)
+     double     cmtyCentrality[nCmtys + 1]            (entry c+1 is community c, as in -center-file)
+     int32      cmty[nVars]                           (community of each variable, from 0)
+     int32      numBridges[nVars]
+     uint8      bridge[nVars]
+
+ The file is keyed by a hash of the clauses it was computed from (mixed with the settings that
+ change its content), so metadata of another formula or of other settings is rejected on load.
+ The same image may live in a named POSIX shared-memory segment instead ('publish', 'attach'),
+ for processes that run on the same instance at the same time.
+
+ Same licence as the rest of Glucose (see LICENCE).
+ **************************************************************************************************/
+
+#ifndef Glucose_Metadata_h
+#define Glucose_Metadata_h
+
+#include <stdint.h>
+#include <string.h>
+
+#include "mtl/Vec.h"
+#include "core/SolverTypes.h"
+
+namespace Glucose {
+
+struct MetadataHeader {
+    char     magic[8];     // "GLCBMETA"
+    uint32_t version;
+    uint32_t nVars;
+    uint32_t nCmtys;
+    uint32_t reserved;
+    uint64_t key;          // Content hash of the formula mixed with the settings.
+    uint64_t size;         // Total file size, to detect truncated files.
+    char     pad[24];
+};
+
+//=================================================================================================
+// Metadata -- a read-only, memory-mapped metadata file or shared-memory segment:
+
+class Metadata {
+    void*    image;
+    uint64_t mapSize;
+
+public:
+    enum { Version = 1 };
+    enum Status { Missing, Invalid, Stale, Loaded };
+
+    int             nVars;
+    int             nCmtys;
+    const double*   cmtyCentrality;
+    const int32_t*  cmty;
+    const int32_t*  numBridges;
+    const uint8_t*  bridge;
+
+    Metadata() : image(NULL), mapSize(0), nVars(0), nCmtys(0), cmtyCentrality(NULL), cmty(NULL), numBridges(NULL), bridge(NULL) { }
+    ~Metadata() { close(); }
+
+    // Maps 'path'. Anything but 'Loaded' leaves the object empty: 'Stale' means a well formed file
+    // for another key or number of variables, 'Invalid' also a community id out of range.
+    Status load  (const char* path, uint64_t key, int nvars);
+    Status attach(const char* name, uint64_t key, int nvars);     // As 'load', for the segment 'name' ("/..").
+    void   close ();
+
+    // Writes a metadata file (to a temporary file renamed into place). Returns FALSE on I/O error.
+    static bool save(const char* path, uint64_t key, int nvars, int ncmtys, const double* cmtyCentrality,
+                     const int* cmty, const int* numBridges, const bool* bridge);
+
+    // Creates the segment 'name' with the same content; FALSE if it exists already or on error. The
+    // magic is written last, so that a segment still being filled is 'Invalid' to 'attach'.
+    static bool publish(const char* name, uint64_t key, int nvars, int ncmtys, const double* cmtyCentrality,
+                        const int* cmty, const int* numBridges, const bool* bridge);
+
+private:
+    Status map(int fd, uint64_t key, int nvars);
+};
+
+// 64-bit content hash of the clauses 'cs' over 'nvars' variables (literal order matters).
+uint64_t hashClauses(const ClauseAllocator& ca, const vec<CRef>& cs, int nvars);
+
+// Mixes the content of the file 'path' into 'h' (NULL and unreadable files mix distinct markers).
+uint64_t hashFile(uint64_t h, const char* path);
+
+// The magic of a shared segment, read and written as one 64-bit word: the publisher writes it last,
+// after a release fence; a reader loads it first, then an acquire fence orders the rest after it.
+static inline uint64_t loadMagic(const void* m) { return __atomic_load_n((const uint64_t*)m, __ATOMIC_RELAXED); }
+static inline void storeMagic(void* m, const char* magic) {
+    uint64_t w;
+    memcpy(&w, magic, sizeof(w));
+    __atomic_store_n((uint64_t*)m, w, __ATOMIC_RELAXED); }
+
+// Mixes 'x' into the hash 'h'.
+static inline uint64_t hashMix(uint64_t h, uint64_t x) {
+    h ^= x + 0x9E3779B97F4A7C15ULL + (h << 6) + (h >> 2);
+    return h * 0xFF51AFD7ED558CCDULL; }
+
+//=================================================================================================
+}
+
+#endif
@@ -0,0 +1,189 @@
+/***********************************************************************************[Portfolio.cc]
+ Same licence as the rest of Glucose (see LICENCE).
+ **************************************************************************************************/
+
+#include "core/Portfolio.h"
+#include "utils/Threads.h"
+
+using namespace Glucose;
+
+static IntOption opt_share_lbd ("CORE", "share-lbd",  "Portfolio threads share the learnt clauses of LBD at most this", 2, IntRange(0, INT32_MAX));
+static IntOption opt_share_size("CORE", "share-size", "Portfolio threads share the learnt clauses of size at most this", 8, IntRange(0, INT32_MAX));
+
+//=================================================================================================
+// ClauseRing:
+
+ClauseRing::ClauseRing() : buf(new std::atomic<int>[Size]), claimed(0), published(0)
+{
+    for (int i = 0; i < Size; i++) buf[i].store(0, std::memory_order_relaxed);
+}
+
+ClauseRing::~ClauseRing() { delete [] buf; }
+
+void ClauseRing::push(const Lit* lits, int size, int lbd)
+{
+    if (size + 2 > Size / 4) return;
+    uint64_t t = published.load(std::memory_order_relaxed);
+    claimed.store(t + size + 2, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    buf[t & Mask].store(size, std::memory_order_relaxed);
+    buf[(t + 1) & Mask].store(lbd, std::memory_order_relaxed);
+    for (int i = 0; i < size; i++)
+        buf[(t + 2 + i) & Mask].store(toInt(lits[i]), std::memory_order_relaxed);
+
+    published.store(t + size + 2, std::memory_order_release);
+}
+
+bool ClauseRing::pop(uint64_t& pos, vec<Lit>& lits, int& lbd) const
+{
+    uint64_t e = end();
+    if (pos == e) return false;
+    if (e - pos > Size) { pos = e; return false; }   // Lapped: skip to the newest clause.
+
+    int size = buf[pos & Mask].load(std::memory_order_relaxed);
+    lbd      = buf[(pos + 1) & Mask].load(std::memory_order_relaxed);
+    bool valid = size > 0 && size + 2 <= Size / 4;
+    lits.clear();
+    for (int i = 0; valid && i < size; i++)
+        lits.push(toLit(buf[(pos + 2 + i) & Mask].load(std::memory_order_relaxed)));
+
+    // The words read are intact if the writer has not claimed past them by a full ring:
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (!valid || claimed.load(std::memory_order_relaxed) - pos > Size) {
+        pos = end();
+        return false; }
+
+    pos += size + 2;
+    return true;
+}
+
+
+//=================================================================================================
+// PortfolioWorker -- a clone of the master exchanging clauses through the rings:
+
+namespace Glucose {
+
+class PortfolioWorker : public Solver {
+    Portfolio&    pf;
+    int           id;
+    vec<uint64_t> cursor;    // Read position in the ring of every thread.
+    vec<Lit>      tmp;
+
+public:
+    uint64_t nExported, nImported;
+
+    PortfolioWorker(const Solver& s, Portfolio& p, int i);
+
+    virtual bool parallelJobIsFinished();
+    virtual bool parallelImportClauses();
+    virtual void parallelExportUnaryClause(Lit p);
+    virtual void parallelExportClauseDuringSearch(Clause& c);
+};
+
+}
+
+PortfolioWorker::PortfolioWorker(const Solver& s, Portfolio& p, int i) :
+    Solver(s), pf(p), id(i), cursor(p.nThreads, 0), nExported(0), nImported(0)
+{
+    verbosity        = 0;
+    searchThreads    = 1;
+    cubeDepth        = 0;
+    bumpPolicy       = (s.bumpPolicy + id) % (BumpNone + 1);
+    random_seed      = s.random_seed + 1000 * id;
+    if (id > BumpNone) {
+        for (int v = 0; v < nVars(); v++)
+            activity[v] += drand(random_seed) * 0.00001;
+        rebuildOrderHeap();
+    }
+    computeBumpMult();
+    for (int r = 0; r < pf.nThreads; r++) cursor[r] = pf.rings[r].end();
+}
+
+bool PortfolioWorker::parallelJobIsFinished() {
+    if (!pf.interrupted()) return false;
+    interrupt();    // Makes 'solve_' leave its restart loop.
+    return true;
+}
+
+void PortfolioWorker::parallelExportUnaryClause(Lit p) {
+    pf.rings[id].push(&p, 1, 1);
+    nExported++;
+}
+
+void PortfolioWorker::parallelExportClauseDuringSearch(Clause& c) {
+    if ((int)c.lbd() > opt_share_lbd && c.size() > opt_share_size) return;
+    tmp.clear();
+    for (int i = 0; i < c.size(); i++) tmp.push(c[i]);
+    pf.rings[id].push((Lit*)tmp, tmp.size(), c.lbd());
+    nExported++;
+}
+
+// Called at decision level 0: returns TRUE if an imported clause is falsified by the root facts.
+bool PortfolioWorker::parallelImportClauses() {
+    int lbd;
+    for (int r = 0; r < pf.nThreads; r++) {
+        if (r == id) continue;
+        while (pf.rings[r].pop(cursor[r], tmp, lbd)) {
+            nImported++;
+            if (!importLearnt(tmp, lbd)) return true;
+        }
+    }
+    return false;
+}
+
+
+//=================================================================================================
+// Portfolio:
+
+Portfolio::Portfolio(Solver& m, int nthreads) :
+    master(m), nThreads(nthreads), rings(new ClauseRing[nthreads]), winner(-1), stop(false)
+  , winnerPolicy(-1), exported(0), imported(0)
+{ }
+
+Portfolio::~Portfolio() { delete [] rings; }
+
+bool Portfolio::interrupted() const {
+    return stop.load(std::memory_order_relaxed) || master.interrupted(); }
+
+lbool Portfolio::solve(const vec<Lit>& assumps)
+{
+    lbool      result = l_Undef;
+    vec<lbool> model;
+    vec<Lit>   conflict;
+    vec<uint64_t> conflicts(nThreads, 0), decisions(nThreads, 0), propagations(nThreads, 0), starts(nThreads, 0);
+    vec<uint64_t> nexp(nThreads, 0), nimp(nThreads, 0);
+
+    runThreads(nThreads, [&](int t) {
+        PortfolioWorker w(master, *this, t);
+        uint64_t c0 = w.conflicts, d0 = w.decisions, p0 = w.propagations, s0 = w.starts;
+        lbool    r  = w.solveLimited(assumps);
+
+        int none = -1;
+        if (r != l_Undef && winner.compare_exchange_strong(none, t)) {
+            stop.store(true);
+            result       = r;
+            winnerPolicy = w.bumpPolicy;
+            w.model.copyTo(model);
+            w.conflict.copyTo(conflict);
+        }
+        conflicts[t]    = w.conflicts - c0;
+        decisions[t]    = w.decisions - d0;
+        propagations[t] = w.propagations - p0;
+        starts[t]       = w.starts - s0;
+        nexp[t]         = w.nExported;
+        nimp[t]         = w.nImported;
+    });
+
+    model.copyTo(master.model);
+    conflict.copyTo(master.conflict);
+    for (int t = 0; t < nThreads; t++) {
+        master.conflicts    += conflicts[t];
+        master.decisions    += decisions[t];
+        master.propagations += propagations[t];
+        master.starts       += starts[t];
+        exported            += nexp[t];
+        imported            += nimp[t];
+    }
+    return result;
+}
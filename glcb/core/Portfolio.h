@@ -0,0 +1,77 @@
+/************************************************************************************[Portfolio.h]
+ Portfolio search: several clones of a solver, each with its own bump policy and seed, race on
+ the same formula and exchange short or low-LBD learnt clauses.
+
+ Same licence as the rest of Glucose (see LICENCE).
+ **************************************************************************************************/
+
+#ifndef Glucose_Portfolio_h
+#define Glucose_Portfolio_h
+
+#include <atomic>
+#include <stdint.h>
+
+#include "mtl/Vec.h"
+#include "core/Solver.h"
+
+namespace Glucose {
+
+//=================================================================================================
+// ClauseRing -- lock-free broadcast queue of learnt clauses:
+//
+// One writer (the thread that learnt the clauses) and any number of readers, each keeping its own
+// position. The buffer is a ring of 'Size' words holding, per clause, its size, its LBD and its
+// literals. A reader that falls more than a ring behind skips to the newest clause; a clause
+// overwritten while it is being read is detected (seqlock style) and dropped.
+
+class ClauseRing {
+    std::atomic<int>*     buf;
+    std::atomic<uint64_t> claimed;     // End of the words being written.
+    std::atomic<uint64_t> published;   // End of the words readers may use.
+
+public:
+    enum { Size = 1 << 19, Mask = Size - 1 };
+
+    ClauseRing();
+    ~ClauseRing();
+
+    void push(const Lit* lits, int size, int lbd);                 // Writer only.
+    bool pop (uint64_t& pos, vec<Lit>& lits, int& lbd) const;      // Next clause after 'pos', if any.
+    uint64_t end() const { return published.load(std::memory_order_acquire); }
+};
+
+
+//=================================================================================================
+// Portfolio -- runs the search of 'Solver::solve_' on several threads:
+//
+// 'master' must be at decision level 0 with its metadata initialised. Thread 'i' works on a clone
+// of it using bump policy (master.bumpPolicy + i) mod 4, so with 4 threads or more every policy
+// runs; threads beyond the first 4 also get randomly perturbed initial activities. The first
+// thread to finish stops the others; its model or final conflict is copied to 'master', and the
+// work of all threads is added to the statistics of 'master'.
+
+class Portfolio {
+    Solver&            master;
+    int                nThreads;
+    ClauseRing*        rings;
+    std::atomic<int>   winner;
+    std::atomic<bool>  stop;
+
+    friend class PortfolioWorker;
+    bool interrupted() const;   // A thread finished or 'master' was interrupted.
+
+public:
+    Portfolio(Solver& master, int nthreads);
+    ~Portfolio();
+
+    lbool solve(const vec<Lit>& assumps);   // Result of the winning thread (l_Undef if none).
+
+    // Statistics:
+    int      winnerPolicy;
+    uint64_t exported, imported;
+};
+
+//=================================================================================================
+}
+
+#endif
@@ -0,0 +1,116 @@
+/****************************************************************************************[Proof.cc]
+ Same licence as the rest of Glucose (see LICENCE).
+ **************************************************************************************************/
+
+#include <chrono>
+#include <string.h>
+#include <unistd.h>
+
+#include "core/Proof.h"
+
+using namespace Glucose;
+
+Proof::Proof(FILE* out, bool bin, bool compress, uint64_t bufferBytes, bool lrat)
+    : f(out), gz(NULL), binary(bin), lratIds(lrat), failed(false), closed(false), checker(NULL), cap(1 << 16), head(0), tail(0), stop(false)
+    , announced(0), inputs(0), first(0), last(0)
+{
+    while (cap < bufferBytes) cap *= 2;
+    ring = new char[cap];
+    if (compress) {
+        fflush(f);
+        int fd = dup(fileno(f));
+        gz = fd >= 0 ? gzdopen(fd, "wb1") : NULL;
+        if (gz == NULL) {
+            if (fd >= 0) ::close(fd);
+            failed = true; }
+    }
+    if (!binary && !lratIds) {
+        static const char header[] = "o proof DRUP\n";
+        push(header, sizeof(header) - 1); }
+    writer = std::thread(&Proof::drain, this);
+}
+
+Proof::~Proof() {
+    close();
+    delete [] ring;
+}
+
+
+// The writer thread: writes what the search thread produced, in contiguous pieces of the ring,
+// and sleeps briefly whenever the ring is empty.
+void Proof::drain() {
+    for (;;) {
+        uint64_t h = head.load(std::memory_order_relaxed);
+        uint64_t t = tail.load(std::memory_order_acquire);
+        if (h == t) {
+            if (stop.load(std::memory_order_acquire) && tail.load(std::memory_order_acquire) == h) break;
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+            continue; }
+
+        uint64_t at = h & (cap - 1);
+        uint64_t n  = t - h < cap - at ? t - h : cap - at;
+        if (!failed) {
+            if (gz != NULL) failed = gzwrite(gz, ring + at, (unsigned)n) != (int)n;
+            else            failed = fwrite(ring + at, 1, n, f) != n;
+        }
+        head.store(h + n, std::memory_order_release);
+    }
+}
+
+
+void Proof::push(const char* data, int n) {
+    while (n > 0) {
+        uint64_t t    = tail.load(std::memory_order_relaxed);
+        uint64_t room = cap - (t - head.load(std::memory_order_acquire));
+        if (room == 0) {
+            std::this_thread::yield();
+            continue; }
+
+        uint64_t at = t & (cap - 1);
+        uint64_t k  = (uint64_t)n;
+        if (k > room)     k = room;
+        if (k > cap - at) k = cap - at;
+        memcpy(ring + at, data, k);
+        tail.store(t + k, std::memory_order_release);
+        data += k;
+        n    -= (int)k;
+    }
+}
+
+
+void Proof::addEmpty() {
+    if (lratIds) return;
+    vec<Lit> empty;
+    add(empty);
+}
+
+
+uint64_t Proof::input() {
+    inputs++;
+    return first == 0 || inputs < first ? inputs : 0;
+}
+
+
+void Proof::drop(uint64_t id) {
+    if (closed || id == 0) return;
+    step.clear();
+    if (binary) step.push('d');
+    else {
+        putNum(last > 0 ? last : inputs, false);
+        step.push('d');
+        step.push(' '); }
+    putNum(id, false);
+    putEnd();
+    push((char*)step, step.size());
+}
+
+
+bool Proof::close() {
+    if (closed) return !failed;
+    closed = true;
+    stop.store(true, std::memory_order_release);
+    writer.join();
+    if (gz != NULL && gzclose(gz) != Z_OK) failed = true;
+    if (fclose(f) != 0) failed = true;
+    return !failed;
+}
@@ -0,0 +1,146 @@
+/****************************************************************************************[Proof.h]
+ Proof output of -certified: the clauses added and deleted by the solver, as text DRUP or binary
+ DRAT, or as LRAT with clause ids and hints, written by a background thread.
+
+ Same licence as the rest of Glucose (see LICENCE).
+ **************************************************************************************************/
+
+#ifndef Glucose_Proof_h
+#define Glucose_Proof_h
+
+#include <atomic>
+#include <stdio.h>
+#include <stdint.h>
+#include <thread>
+#include <zlib.h>
+
+#include "mtl/Vec.h"
+#include "core/SolverTypes.h"
+#include "core/ProofChecker.h"
+
+namespace Glucose {
+
+//=================================================================================================
+// Proof -- a proof stream:
+//
+// Each step is encoded on the search thread into a ring buffer of a fixed size (a single
+// producer, single consumer queue with two atomic counters, no lock); a writer thread drains it to
+// the file, through zlib if 'compress'. The search thread only waits when the writer falls a whole
+// buffer behind. Formats:
+//
+//   text     "o proof DRUP" first, then lines "l1 l2 .. 0" (added) and "d l1 l2 .. 0" (deleted),
+//            literals in DIMACS.
+//   binary   binary DRAT: 'a' or 'd', then each literal 'l' (DIMACS) as the unsigned 2|l| + (l < 0)
+//            in 7-bit groups, low group first, high bit set on all groups but the last; then 0.
+//   lrat     "id l1 l2 .. 0 h1 h2 .. 0" (added: the clause 'id' follows by unit propagation over the
+//            hints, in order) and "id d i1 i2 .. 0" (deleted); in binary, 'a' id lits 0 hints 0 and
+//            'd' ids 0, ids encoded as the literals of the same positive number.
+//
+// In LRAT the input clauses are numbered 1, 2, .. in the order of the file, and the lemmas after
+// them: the caller takes an id from 'input' for every clause it reads, and announces the number of
+// clauses of the DIMACS header before the first lemma (with 'setInputs').
+//
+// 'close' must be called before the process exits, since steps still in the buffer are lost
+// otherwise. Steps given after it are ignored. A DRUP / DRAT proof may also be passed to a checker
+// ('setChecker'), which needs the input clauses as well ('original').
+
+class Proof {
+    FILE*     f;
+    gzFile    gz;
+    bool      binary;
+    bool      lratIds;
+    bool      failed;
+    bool      closed;
+    ProofChecker* checker;
+
+    char*     ring;
+    uint64_t  cap;                  // A power of 2.
+    std::atomic<uint64_t> head;     // Bytes written out (advanced by the writer).
+    std::atomic<uint64_t> tail;     // Bytes produced (advanced by the search thread).
+    std::atomic<bool>     stop;
+    std::thread           writer;
+
+    vec<char> step;                 // Encoding of the current step.
+
+    uint64_t  announced;            // LRAT: clauses of the DIMACS header,
+    uint64_t  inputs;               //       input clauses numbered so far,
+    uint64_t  first, last;          //       first and last lemma ids (0 before the first lemma).
+
+    void drain ();                              // Writer thread.
+    void push  (const char* data, int n);       // Copy into the ring, waiting for room if needed.
+    void putNum(uint64_t u, bool neg) {
+        if (binary) {
+            u = 2 * u + neg;
+            while (u > 127) { step.push((char)(128 | (u & 127))); u >>= 7; }
+            step.push((char)u);
+        } else {
+            char digits[20];
+            int  n = 0;
+            if (neg) step.push('-');
+            do { digits[n++] = '0' + u % 10; u /= 10; } while (u > 0);
+            while (n > 0) step.push(digits[--n]);
+            step.push(' ');
+        } }
+    void putLit(Lit p) { putNum(var(p) + 1, sign(p)); }
+    void putEnd()      { if (binary) step.push(0); else { step.push('0'); step.push('\n'); } }
+
+    template<class Lits>
+    void emit(bool del, const Lits& c, Lit skip) {
+        if (closed) return;
+        if (checker != NULL) {
+            if (del) checker->remove(c);
+            else     checker->add(c, skip); }
+        step.clear();
+        if (binary) step.push(del ? 'd' : 'a');
+        else if (del) { step.push('d'); step.push(' '); }
+        for (int i = 0; i < c.size(); i++)
+            if (c[i] != skip) putLit(c[i]);
+        putEnd();
+        push((char*)step, step.size()); }
+
+public:
+    // Takes over 'out'; 'bufferBytes' is rounded up to a power of 2.
+    Proof(FILE* out, bool binary, bool compress, uint64_t bufferBytes, bool lrat = false);
+    ~Proof();
+
+    bool lrat() const { return lratIds; }
+    void setChecker(ProofChecker* c) { checker = c; }                     // Not owned.
+
+    // DRUP / DRAT:
+    template<class Lits> void add   (const Lits& c, Lit skip = lit_Undef) { emit(false, c, skip); }   // Without the literal 'skip', if given.
+    template<class Lits> void remove(const Lits& c)                       { emit(true,  c, lit_Undef); }
+    template<class Lits> void original(const Lits& c) { if (checker != NULL && !closed) checker->input(c); }   // An input clause (not written).
+    void addEmpty();                                                      // The empty clause: the proof is complete (not in LRAT, where
+                                                                          // the solver derives it with its hints).
+    // LRAT:
+    void     setInputs(uint64_t n) { announced = n; }
+    uint64_t input    ();                                                 // Id of the next input clause, 0 if taken by a lemma already.
+    template<class Lits>
+    uint64_t lemma    (const Lits& c, const vec<uint64_t>& hints);       // Writes 'c' and returns its id.
+    void     drop     (uint64_t id);                                     // Deletes the clause 'id' (nothing if 0).
+
+    bool close();                   // Write out the buffer and close the file; FALSE if a write failed.
+};
+
+
+template<class Lits>
+uint64_t Proof::lemma(const Lits& c, const vec<uint64_t>& hints) {
+    if (first == 0) first = last = (inputs > announced ? inputs : announced) + 1;
+    else            last++;
+    if (closed) return last;
+    step.clear();
+    if (binary) step.push('a');
+    putNum(last, false);
+    for (int i = 0; i < c.size(); i++) putLit(c[i]);
+    if (binary) step.push(0);
+    else { step.push('0'); step.push(' '); }
+    for (int i = 0; i < hints.size(); i++) putNum(hints[i], false);
+    putEnd();
+    push((char*)step, step.size());
+    return last;
+}
+
+//=================================================================================================
+}
+
+#endif
@@ -0,0 +1,303 @@
+/*********************************************************************************[ProofChecker.cc]
+ Same licence as the rest of Glucose (see LICENCE).
+ **************************************************************************************************/
+
+#include <chrono>
+#include <string.h>
+
+#include "mtl/Sort.h"
+#include "core/Metadata.h"
+#include "core/ProofChecker.h"
+
+using namespace Glucose;
+
+ProofChecker::ProofChecker(uint64_t bufferBytes)
+    : cap(1 << 14), head(0), tail(0), stop(false), cancelled(false)
+    , watches(WatcherDeleted(ca)), nClauses(0), qhead(0), inconsistent(false)
+    , refuted(false), nLemmas(0), failed(0), nMissing(0)
+{
+    while (cap * sizeof(uint32_t) < bufferBytes) cap *= 2;
+    ring = new uint32_t[cap];
+    table.growTo(1 << 10);
+    worker = std::thread(&ProofChecker::run, this);
+}
+
+ProofChecker::~ProofChecker() {
+    if (worker.joinable()) cancel();
+    delete [] ring;
+}
+
+
+//=================================================================================================
+// Queue:
+
+
+void ProofChecker::push(const uint32_t* data, int n) {
+    while (n > 0) {
+        uint64_t t    = tail.load(std::memory_order_relaxed);
+        uint64_t room = cap - (t - head.load(std::memory_order_acquire));
+        if (room == 0) {
+            std::this_thread::yield();
+            continue; }
+
+        uint64_t at = t & (cap - 1);
+        uint64_t k  = (uint64_t)n;
+        if (k > room)     k = room;
+        if (k > cap - at) k = cap - at;
+        memcpy(ring + at, data, k * sizeof(uint32_t));
+        tail.store(t + k, std::memory_order_release);
+        data += k;
+        n    -= (int)k;
+    }
+}
+
+
+bool ProofChecker::next(uint32_t& w) {
+    uint64_t h = head.load(std::memory_order_relaxed);
+    while (tail.load(std::memory_order_acquire) == h) {
+        if (cancelled.load(std::memory_order_acquire)) return false;
+        if (stop.load(std::memory_order_acquire) && tail.load(std::memory_order_acquire) == h) return false;
+        std::this_thread::sleep_for(std::chrono::microseconds(200));
+    }
+    w = ring[h & (cap - 1)];
+    head.store(h + 1, std::memory_order_release);
+    return true;
+}
+
+
+void ProofChecker::run() {
+    vec<Lit> c;
+    uint32_t w;
+    while (next(w)) {
+        int kind = w & 3;
+        int n    = w >> 2;
+        c.clear();
+        for (int i = 0; i < n && next(w); i++) c.push(toLit(w));
+        if (c.size() < n) break;
+        if (failed == 0) apply(kind, c);
+    }
+}
+
+
+bool ProofChecker::finish() {
+    stop.store(true, std::memory_order_release);
+    worker.join();
+    return refuted && failed == 0;
+}
+
+
+void ProofChecker::cancel() {
+    cancelled.store(true, std::memory_order_release);
+    stop.store(true, std::memory_order_release);
+    worker.join();
+}
+
+
+//=================================================================================================
+// Database:
+
+
+void ProofChecker::apply(int kind, vec<Lit>& c) {
+    for (int i = 0; i < c.size(); i++)
+        while (var(c[i]) >= assigns.size()) {
+            Var v = assigns.size();
+            assigns.push(l_Undef);
+            marks.push(0);
+            marks.push(0);
+            watches.init(mkLit(v, false));
+            watches.init(mkLit(v, true)); }
+
+    if (kind == Add) {
+        nLemmas++;
+        if (!implied(c)) {
+            failed = nLemmas;
+            return; }
+        if (c.size() == 0) {
+            refuted = true;
+            return; }
+    }
+    if (inconsistent && kind != Remove) return;     // Everything follows.
+
+    bool     clause = canonical(c);                 // (tautologies are left out)
+    uint64_t h      = clause ? hashOf(c) : 0;
+    if (!clause) return;
+    if (kind == Remove) erase(c, h);
+    else                insert(c, h);
+}
+
+
+bool ProofChecker::canonical(vec<Lit>& c) {
+    sort(c);
+    int i, j;
+    Lit p = lit_Undef;
+    for (i = j = 0; i < c.size(); i++)
+        if (c[i] == ~p) return false;
+        else if (c[i] != p) c[j++] = p = c[i];
+    c.shrink(i - j);
+    return true;
+}
+
+
+uint64_t ProofChecker::hashOf(const vec<Lit>& c) const {
+    uint64_t h = c.size();
+    for (int i = 0; i < c.size(); i++) h = hashMix(h, toInt(c[i]));
+    return h;
+}
+
+
+// Adds the canonical clause 'c' and brings the root level up to date: a clause with one literal
+// left at the root is propagated there, one with none makes the database inconsistent.
+void ProofChecker::insert(vec<Lit>& c, uint64_t h) {
+    int free = 0;
+    for (int i = 0; i < c.size() && free < 2; i++)
+        if (value(c[i]) != l_False) {
+            Lit t = c[free]; c[free] = c[i]; c[i] = t;
+            free++; }
+
+    CRef  cr = ca.alloc(c, false);
+    Entry e;
+    e.hash = h;
+    e.cref = cr;
+    table[h & (table.size() - 1)].push(e);
+    nClauses++;
+
+    if (c.size() >= 2) {
+        watches[~c[0]].push(Watcher(cr, c[1]));
+        watches[~c[1]].push(Watcher(cr, c[0])); }
+    if (free == 0)
+        inconsistent = true;
+    else if (free == 1 && value(c[0]) == l_Undef) {
+        assign(c[0]);
+        if (propagate() != CRef_Undef) inconsistent = true;
+        qhead = trail.size(); }
+
+    if (nClauses > 2 * table.size()) {              // Grow the table.
+        vec<vec<Entry> > bigger(table.size() * 2);
+        for (int i = 0; i < table.size(); i++)
+            for (int j = 0; j < table[i].size(); j++)
+                bigger[table[i][j].hash & (bigger.size() - 1)].push(table[i][j]);
+        bigger.moveTo(table);
+    }
+}
+
+
+void ProofChecker::erase(const vec<Lit>& c, uint64_t h) {
+    vec<Entry>& bucket = table[h & (table.size() - 1)];
+    for (int i = 0; i < c.size(); i++) marks[toInt(c[i])] = 1;
+    int k = 0;
+    for (; k < bucket.size(); k++) {
+        if (bucket[k].hash != h) continue;
+        const Clause& d = ca[bucket[k].cref];
+        bool same = d.size() == c.size();
+        for (int i = 0; i < d.size() && same; i++) same = marks[toInt(d[i])];
+        if (same) break;
+    }
+    for (int i = 0; i < c.size(); i++) marks[toInt(c[i])] = 0;
+    if (k == bucket.size()) {
+        nMissing++;
+        return; }
+
+    CRef    cr = bucket[k].cref;
+    Clause& d  = ca[cr];
+    bucket[k] = bucket.last();
+    bucket.pop();
+    nClauses--;
+    if (d.size() >= 2) {
+        watches.smudge(~d[0]);
+        watches.smudge(~d[1]); }
+    d.mark(1);
+    ca.free(cr);
+    checkGarbage();
+}
+
+
+//=================================================================================================
+// Propagation:
+
+
+// Assigns the negation of 'c' above the root level and propagates: TRUE on a conflict. A clause
+// with a literal true at the root is implied as well.
+bool ProofChecker::implied(const vec<Lit>& c) {
+    if (inconsistent) return true;
+    for (int i = 0; i < c.size(); i++)
+        if (value(c[i]) == l_True) return true;
+
+    int root = trail.size();
+    for (int i = 0; i < c.size(); i++)
+        if (value(c[i]) == l_Undef) assign(~c[i]);
+    bool conflict = propagate() != CRef_Undef;
+    backtrack(root);
+    return conflict;
+}
+
+
+void ProofChecker::backtrack(int level) {
+    for (int i = trail.size() - 1; i >= level; i--)
+        assigns[var(trail[i])] = l_Undef;
+    trail.shrink(trail.size() - level);
+    qhead = level;
+}
+
+
+// As 'Solver::propagate', without reasons nor levels.
+CRef ProofChecker::propagate() {
+    CRef confl = CRef_Undef;
+    watches.cleanAll();
+    while (qhead < trail.size()) {
+        Lit            p  = trail[qhead++];
+        vec<Watcher>&  ws = watches[p];
+        Watcher        *i, *j, *end;
+
+        for (i = j = (Watcher*)ws, end = i + ws.size(); i != end;) {
+            Lit blocker = i->blocker;
+            if (value(blocker) == l_True) {
+                *j++ = *i++;
+                continue; }
+
+            CRef    cr        = i->cref;
+            Clause& c         = ca[cr];
+            Lit     false_lit = ~p;
+            if (c[0] == false_lit)
+                c[0] = c[1], c[1] = false_lit;
+            i++;
+
+            Lit     first = c[0];
+            Watcher w     = Watcher(cr, first);
+            if (first != blocker && value(first) == l_True) {
+                *j++ = w;
+                continue; }
+
+            for (int k = 2; k < c.size(); k++)
+                if (value(c[k]) != l_False) {
+                    c[1] = c[k]; c[k] = false_lit;
+                    watches[~c[1]].push(w);
+                    goto NextClause; }
+
+            *j++ = w;
+            if (value(first) == l_False) {
+                confl = cr;
+                qhead = trail.size();
+                while (i < end) *j++ = *i++;
+            } else
+                assign(first);
+        NextClause:;
+        }
+        ws.shrink(i - j);
+    }
+    return confl;
+}
+
+
+// Compacts the clause arena when a fifth of it is deleted clauses.
+void ProofChecker::checkGarbage() {
+    if (ca.wasted() <= ca.size() / 5) return;
+    ClauseAllocator to(ca.size() - ca.wasted());
+    watches.cleanAll();
+    for (int i = 0; i < 2 * assigns.size(); i++) {
+        vec<Watcher>& ws = watches[toLit(i)];
+        for (int j = 0; j < ws.size(); j++) ca.reloc(ws[j].cref, to);
+    }
+    for (int i = 0; i < table.size(); i++)
+        for (int j = 0; j < table[i].size(); j++) ca.reloc(table[i][j].cref, to);
+    to.moveTo(ca);
+}
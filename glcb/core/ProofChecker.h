@@ -0,0 +1,127 @@
+/*********************************************************************************[ProofChecker.h]
+ Check of a DRUP proof while the solver writes it (-certified-check): a thread next to the search
+ verifies each lemma by unit propagation on a clause database of its own, so that an UNSAT answer
+ is confirmed shortly after the search ends rather than by a second pass over the proof file.
+
+ Same licence as the rest of Glucose (see LICENCE).
+ **************************************************************************************************/
+
+#ifndef Glucose_ProofChecker_h
+#define Glucose_ProofChecker_h
+
+#include <atomic>
+#include <stdint.h>
+#include <thread>
+
+#include "mtl/Vec.h"
+#include "core/SolverTypes.h"
+
+namespace Glucose {
+
+//=================================================================================================
+// ProofChecker -- a forward RUP checker:
+//
+// The steps (input clauses, lemmas, deletions) are queued by the search thread in a ring of words
+// (a single producer, single consumer queue, as in 'Proof') and replayed by the checker thread.
+// A lemma holds if unit propagation on the database and the negation of the lemma ends in a
+// conflict; it is then added to the database. The facts of the root level are kept when a clause
+// that implied them is deleted, as drat-trim does: each was implied by the clauses at the time, so
+// a lemma that needs one is still implied by the formula. Deletions of clauses not in the database
+// are ignored (and counted).
+
+class ProofChecker {
+    enum { Input = 0, Add = 1, Remove = 2 };
+
+    struct Watcher {
+        CRef cref;
+        Lit  blocker;
+        Watcher(CRef cr, Lit p) : cref(cr), blocker(p) {}
+        bool operator==(const Watcher& w) const { return cref == w.cref; }
+        bool operator!=(const Watcher& w) const { return cref != w.cref; }
+    };
+
+    struct WatcherDeleted {
+        const ClauseAllocator& ca;
+        WatcherDeleted(const ClauseAllocator& _ca) : ca(_ca) {}
+        bool operator()(const Watcher& w) const { return ca[w.cref].mark() == 1; }
+    };
+
+    struct Entry {                  // A clause of the database, by the hash of its literal set.
+        uint64_t hash;
+        CRef     cref;
+    };
+
+    // Queue:
+    uint32_t*             ring;
+    uint64_t              cap;      // In words, a power of 2.
+    std::atomic<uint64_t> head;     // Words consumed (advanced by the checker).
+    std::atomic<uint64_t> tail;     // Words produced (advanced by the search thread).
+    std::atomic<bool>     stop;     // No more steps: finish the queue and return.
+    std::atomic<bool>     cancelled;// Return at once.
+    std::thread           worker;
+    vec<uint32_t>         step;     // Encoding of the current step.
+
+    // Database:
+    ClauseAllocator       ca;
+    OccLists<Lit, vec<Watcher>, WatcherDeleted> watches;
+    vec<vec<Entry> >      table;    // Open hash table of the clauses, a power of 2 of buckets.
+    int                   nClauses;
+    vec<lbool>            assigns;
+    vec<char>             marks;    // Per literal, for comparing clauses.
+    vec<Lit>              trail;
+    int                   qhead;
+    bool                  inconsistent; // Propagation at the root level found a conflict.
+
+    // Results:
+    bool                  refuted;  // The empty clause was added.
+    uint64_t              nLemmas;
+    uint64_t              failed;   // Number of the first lemma that does not hold, 0 if none.
+    uint64_t              nMissing;
+
+    lbool    value     (Lit p) const { return assigns[var(p)] ^ sign(p); }
+    void     assign    (Lit p)       { assigns[var(p)] = lbool(!sign(p)); trail.push(p); }
+
+    void     run       ();                              // Checker thread.
+    bool     next      (uint32_t& w);                   // Next word of the queue, FALSE at the end.
+    void     push      (const uint32_t* data, int n);   // Copy into the ring, waiting for room if needed.
+    void     apply     (int kind, vec<Lit>& c);
+    bool     canonical (vec<Lit>& c);                   // Sort, drop repeated literals; FALSE if a tautology.
+    uint64_t hashOf    (const vec<Lit>& c) const;
+    void     insert    (vec<Lit>& c, uint64_t h);
+    void     erase     (const vec<Lit>& c, uint64_t h);
+    bool     implied   (const vec<Lit>& c);             // RUP test.
+    CRef     propagate ();
+    void     backtrack (int level);
+    void     checkGarbage();
+
+    template<class Lits>
+    void put(int kind, const Lits& c, Lit skip) {
+        step.clear();
+        step.push(0);
+        for (int i = 0; i < c.size(); i++)
+            if (c[i] != skip) step.push((uint32_t)toInt(c[i]));
+        step[0] = kind | (uint32_t)(step.size() - 1) << 2;
+        push((uint32_t*)step, step.size()); }
+
+public:
+    // 'bufferBytes' is rounded up to a power of 2.
+    explicit ProofChecker(uint64_t bufferBytes);
+    ~ProofChecker();
+
+    // Steps, in the order of the proof (search thread):
+    template<class Lits> void input (const Lits& c)                       { put(Input,  c, lit_Undef); }
+    template<class Lits> void add   (const Lits& c, Lit skip = lit_Undef) { put(Add,    c, skip); }    // Without the literal 'skip', if given.
+    template<class Lits> void remove(const Lits& c)                       { put(Remove, c, lit_Undef); }
+
+    bool     finish  ();            // Wait until all steps are checked: TRUE if the empty clause was derived and every lemma holds.
+    void     cancel  ();            // Stop checking (the answer is not UNSAT).
+
+    uint64_t lemmas  () const { return nLemmas; }    // After 'finish': lemmas checked,
+    uint64_t failedAt() const { return failed; }     // the first one that does not hold (from 1), 0 if none,
+    uint64_t missing () const { return nMissing; }   // deletions of clauses not in the database.
+};
+
+//=================================================================================================
+}
+
+#endif
@@ -0,0 +1,213 @@
+/*********************************************************************************[ResultCache.cc]
+ Same licence as the rest of Glucose (see LICENCE).
+ **************************************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "mtl/Sort.h"
+#include "core/Metadata.h"
+#include "core/ResultCache.h"
+
+using namespace Glucose;
+
+static const char resultMagic[8] = { 'G', 'L', 'C', 'B', 'R', 'S', 'L', 'T' };
+
+// Colour of a clause from the colours of its variables.
+static inline uint64_t clauseColour(const Lit* ps, int n, const vec<uint64_t>& colour) {
+    uint64_t sum = 0;
+    for (int i = 0; i < n; i++) sum += hashMix(colour[var(ps[i])], sign(ps[i]) + 1);
+    return hashMix(n, sum);
+}
+
+// Hash of a clause in the numbering 'rank', independent of the order of its literals.
+static uint64_t clauseHash(const Lit* ps, int n, const vec<int>& rank, vec<int>& tmp) {
+    tmp.clear();
+    for (int i = 0; i < n; i++) tmp.push(toInt(mkLit(rank[var(ps[i])], sign(ps[i]))));
+    sort(tmp);
+    uint64_t h = hashMix(0, n);
+    for (int i = 0; i < n; i++) h = hashMix(h, tmp[i] + 1);
+    return h;
+}
+
+struct ColourLt {
+    const vec<uint64_t>& colour;
+    ColourLt(const vec<uint64_t>& c) : colour(c) { }
+    bool operator()(Var x, Var y) const { return colour[x] < colour[y]; }
+};
+
+//=================================================================================================
+// Key:
+
+void ResultCache::computeKey(Solver& S)
+{
+    // The formula: problem clauses simplified by the root facts, and the root facts as unit
+    // clauses. This does not depend on the order in which the clauses were added.
+    vec<Lit> lits;
+    vec<int> starts;
+    for (int i = 0; i < S.clauses.size(); i++) {
+        const Clause& c = S.ca[S.clauses[i]];
+        bool satisfied = false;
+        for (int j = 0; !satisfied && j < c.size(); j++) satisfied = S.value(c[j]) == l_True;
+        if (satisfied) continue;
+        starts.push(lits.size());
+        for (int j = 0; j < c.size(); j++)
+            if (S.value(c[j]) != l_False) lits.push(c[j]);
+    }
+    for (int i = 0; i < S.trail.size(); i++) {
+        starts.push(lits.size());
+        lits.push(S.trail[i]); }
+    vec<const Lit*> cls;
+    vec<int>        sizes;
+    for (int i = 0; i < starts.size(); i++) {
+        cls.push(&lits[starts[i]]);
+        sizes.push((i + 1 < starts.size() ? starts[i + 1] : lits.size()) - starts[i]); }
+
+    int       n = S.nVars();
+    vec<bool> occurs(n, false);
+    for (int i = 0; i < cls.size(); i++)
+        for (int j = 0; j < sizes[i]; j++) occurs[var(cls[i][j])] = true;
+    order.clear();
+    for (Var v = 0; v < n; v++)
+        if (occurs[v]) order.push(v);
+    int k = order.size();
+
+    // Colour refinement:
+    vec<uint64_t> colour(n, 1), acc(n, 0), sorted;
+    int           ncolours = 1;
+    for (int round = 0; round < 64 && ncolours < k; round++) {
+        for (int i = 0; i < k; i++) acc[order[i]] = 0;
+        for (int i = 0; i < cls.size(); i++) {
+            uint64_t cc = clauseColour(cls[i], sizes[i], colour);
+            for (int j = 0; j < sizes[i]; j++)
+                acc[var(cls[i][j])] += hashMix(cc, sign(cls[i][j]) + 1);
+        }
+        sorted.clear();
+        for (int i = 0; i < k; i++) {
+            Var v = order[i];
+            colour[v] = hashMix(colour[v], acc[v]);
+            sorted.push(colour[v]); }
+        sort(sorted);
+        int distinct = k > 0 ? 1 : 0;
+        for (int i = 1; i < k; i++)
+            if (sorted[i] != sorted[i - 1]) distinct++;
+        if (distinct <= ncolours && round > 0) break;
+        ncolours = distinct;
+    }
+    canonical = ncolours == k;
+    if (canonical) sort(order, ColourLt(colour));
+
+    vec<int> rank(n, -1), tmp;
+    for (int i = 0; i < k; i++) rank[order[i]] = i;
+    vec<uint64_t> hs;
+    for (int i = 0; i < cls.size(); i++) hs.push(clauseHash(cls[i], sizes[i], rank, tmp));
+    sort(hs);
+
+    key = hashMix(hashMix(Version, k), canonical);
+    for (int i = 0; i < hs.size(); i++) key = hashMix(key, hs[i]);
+    key = hashMix(key, S.bumpPolicy);
+    key = hashMix(key, S.centerDecisions);
+    nClauses = hs.size();
+}
+
+char* ResultCache::path(const char* suffix) const
+{
+    char* p = new char[strlen(dir) + 64];
+    sprintf(p, "%s/%016llx.res%s", dir, (unsigned long long)key, suffix);
+    return p;
+}
+
+
+//=================================================================================================
+// Lookup and store:
+
+lbool ResultCache::lookup(Solver& S, Entry& e)
+{
+    computeKey(S);
+    char* p = path("");
+    FILE* f = fopen(p, "rb");
+    delete [] p;
+    if (f == NULL) return l_Undef;
+
+    ResultHeader h;
+    vec<uint8_t> bytes(order.size());
+    bool ok = fread(&h, sizeof(h), 1, f) == 1
+           && memcmp(h.magic, resultMagic, sizeof(resultMagic)) == 0 && h.version == Version
+           && h.key == key && h.nVars == (uint32_t)order.size() && h.nClauses == (uint32_t)nClauses
+           && (h.status == 10 || h.status == 20)
+           && (h.status == 20 || fread((uint8_t*)bytes, 1, order.size(), f) == (size_t)order.size());
+    fclose(f);
+    if (!ok) return l_Undef;
+
+    if (h.status == 10) {
+        S.model.clear();
+        S.model.growTo(S.nVars(), l_False);
+        for (int i = 0; i < order.size(); i++)
+            S.model[order[i]] = bytes[i] == 0 ? l_False : bytes[i] == 1 ? l_True : l_Undef;
+
+        // Check the model (the key is only a hash):
+        for (int i = 0; ok && i < S.clauses.size(); i++) {
+            const Clause& c = S.ca[S.clauses[i]];
+            bool sat = false;
+            for (int j = 0; !sat && j < c.size(); j++)
+                sat = (S.model[var(c[j])] ^ sign(c[j])) == l_True;
+            ok = sat; }
+        for (int i = 0; ok && i < S.trail.size(); i++)
+            ok = (S.model[var(S.trail[i])] ^ sign(S.trail[i])) == l_True;
+        if (!ok) {
+            S.model.clear();
+            return l_Undef; }
+    }
+
+    e.status       = h.status == 10 ? l_True : l_False;
+    e.cpu          = h.cpu;
+    e.conflicts    = h.conflicts;
+    e.decisions    = h.decisions;
+    e.propagations = h.propagations;
+    e.restarts     = h.restarts;
+    return e.status;
+}
+
+bool ResultCache::store(const Solver& S, lbool status, double cpu)
+{
+    if (status == l_Undef || (status == l_True && S.model.size() < S.nVars())) return false;
+
+    ResultHeader h;
+    memset(&h, 0, sizeof(h));
+    memcpy(h.magic, resultMagic, sizeof(resultMagic));
+    h.version      = Version;
+    h.status       = status == l_True ? 10 : 20;
+    h.nVars        = order.size();
+    h.nClauses     = nClauses;
+    h.key          = key;
+    h.cpu          = cpu;
+    h.conflicts    = S.conflicts;
+    h.decisions    = S.decisions;
+    h.propagations = S.propagations;
+    h.restarts     = S.starts;
+
+    vec<uint8_t> bytes;
+    if (status == l_True)
+        for (int i = 0; i < order.size(); i++) {
+            lbool b = S.model[order[i]];
+            bytes.push(b == l_False ? 0 : b == l_True ? 1 : 2); }
+
+    // Written aside and renamed, so that concurrent solvers never see a partial file:
+    char  suffix[32];
+    sprintf(suffix, ".tmp.%d", (int)getpid());
+    char* tmp = path(suffix);
+    char* p   = path("");
+    FILE* f   = fopen(tmp, "wb");
+    bool  ok  = f != NULL;
+    if (ok) {
+        ok = fwrite(&h, sizeof(h), 1, f) == 1
+          && fwrite((uint8_t*)bytes, 1, bytes.size(), f) == (size_t)bytes.size();
+        ok = fclose(f) == 0 && ok;
+        ok = ok && rename(tmp, p) == 0;
+        if (!ok) ::remove(tmp);
+    }
+    delete [] tmp;
+    delete [] p;
+    return ok;
+}
@@ -0,0 +1,89 @@
+/**********************************************************************************[ResultCache.h]
+ On-disk cache of solve results, keyed by a hash of the formula that does not depend on the order
+ of the clauses and literals, nor (in most cases) on the numbering of the variables.
+
+ A directory holds one file per formula, named after its key ('<key in hex>.res'):
+
+     header     ResultHeader                          (80 bytes, native endianness)
+     uint8      model[nVars]                          (SAT only: 0 false, 1 true, 2 undefined)
+
+ The model is stored in the canonical numbering of the variables, see 'ResultCache::lookup'.
+
+ Same licence as the rest of Glucose (see LICENCE).
+ **************************************************************************************************/
+
+#ifndef Glucose_ResultCache_h
+#define Glucose_ResultCache_h
+
+#include <stdint.h>
+
+#include "mtl/Vec.h"
+#include "core/Solver.h"
+
+namespace Glucose {
+
+struct ResultHeader {
+    char     magic[8];     // "GLCBRSLT"
+    uint32_t version;
+    uint32_t status;       // 10 (SAT) or 20 (UNSAT).
+    uint32_t nVars;        // Variables occurring in the formula.
+    uint32_t nClauses;
+    uint64_t key;
+    double   cpu;          // Statistics of the solve that found the result.
+    uint64_t conflicts, decisions, propagations, restarts;
+    char     pad[8];
+};
+
+//=================================================================================================
+// ResultCache -- results of the formulas solved before, in the directory 'dir':
+//
+// 'lookup' computes the key of the formula of 'S' (its problem clauses simplified by its root facts,
+// and the root facts, right after parsing) and looks it up; 'store' records the result of that formula once it is solved.
+//
+// The key is computed on a canonical numbering of the occurring variables. Variables are coloured
+// by refinement (a colour mixes the previous colour of the variable with the colours of the clauses
+// it occurs in, by polarity) until the number of colours stops growing. If every variable ends with
+// a colour of its own, variables are numbered by colour, which is the same for any renaming of the
+// formula; otherwise (formulas with symmetries) they keep their order, and only reorderings of the
+// clauses and literals map to the same key. The clauses are then hashed in this numbering with
+// sorted literals, and the sorted clause hashes mixed with the bump policy settings.
+//
+// A cached model is mapped back to the variables of 'S' and checked against its clauses; a model
+// that does not satisfy them counts as a miss.
+
+class ResultCache {
+    const char*  dir;
+    uint64_t     key;
+    bool         canonical;      // 'order' is the colour order (else the index order).
+    vec<Var>     order;          // order[i] = variable numbered i.
+    int          nClauses;
+
+    void  computeKey(Solver& S);
+    char* path(const char* suffix) const;
+
+public:
+    struct Entry {
+        lbool    status;
+        double   cpu;
+        uint64_t conflicts, decisions, propagations, restarts;
+    };
+
+    enum { Version = 1 };
+
+    explicit ResultCache(const char* dir) : dir(dir), key(0), canonical(false), nClauses(0) { }
+
+    // The cached result of the formula of 'S', or l_Undef. On SAT, 'S.model' gets the model.
+    lbool    lookup(Solver& S, Entry& e);
+
+    // Records the result 'status' of the formula given to 'lookup', with the model and the
+    // statistics of 'S'. Returns FALSE on I/O error.
+    bool     store (const Solver& S, lbool status, double cpu);
+
+    uint64_t formulaKey      () const { return key; }          // After 'lookup'.
+    bool     renamingInvariant() const { return canonical; }    // The key holds for any renaming of the variables.
+};
+
+//=================================================================================================
+}
+
+#endif
@@ -0,0 +1,123 @@
+/********************************************************************************[SharedFormula.cc]
+ Same licence as the rest of Glucose (see LICENCE).
+ **************************************************************************************************/
+
+#include <atomic>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "core/Metadata.h"
+#include "core/SharedFormula.h"
+
+using namespace Glucose;
+
+static const char formMagic[8] = { 'G', 'L', 'C', 'B', 'F', 'O', 'R', 'M' };
+
+//=================================================================================================
+// SharedFormula:
+
+SharedFormula::Status SharedFormula::attach(const char* name, uint64_t source)
+{
+    close();
+    int fd = shm_open(name, O_RDONLY, 0);
+    if (fd < 0) return errno == ENOENT ? Missing : Invalid;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (uint64_t)st.st_size < sizeof(SharedFormulaHeader)) {
+        ::close(fd);
+        return Invalid; }
+
+    void* m = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (m == MAP_FAILED) return Invalid;
+
+    const SharedFormulaHeader& h     = *(const SharedFormulaHeader*)m;
+    uint64_t                   magic = loadMagic(m);
+    std::atomic_thread_fence(std::memory_order_acquire);        // (see 'publish')
+    const int32_t*             l     = (const int32_t*)((const char*)m + sizeof(SharedFormulaHeader));
+
+    Status s = Attached;
+    if (memcmp(&magic, formMagic, sizeof(formMagic)) != 0)
+        s = Invalid;
+    else if (h.version != Version || h.source != source)
+        s = Stale;
+    else if (h.nLits > INT32_MAX || h.maxVar < 0 || h.size != (uint64_t)st.st_size
+             || h.size != sizeof(SharedFormulaHeader) + sizeof(int32_t) * h.nLits)
+        s = Invalid;
+    else if (h.nLits > 0 && l[h.nLits - 1] != 0)                // A clause left open.
+        s = Invalid;
+    else
+        for (uint64_t i = 0; i < h.nLits && s == Attached; i++)
+            if (l[i] < -h.maxVar || l[i] > h.maxVar) s = Invalid;
+
+    if (s != Attached) {
+        munmap(m, st.st_size);
+        return s; }
+
+    image   = m;
+    mapSize = st.st_size;
+    vars    = h.vars;
+    clauses = h.clauses;
+    nLits   = h.nLits;
+    lits    = l;
+    return Attached;
+}
+
+void SharedFormula::close()
+{
+    if (image != NULL) munmap(image, mapSize);
+    image   = NULL;
+    mapSize = 0;
+    vars    = clauses = 0;
+    lits    = NULL;
+    nLits   = 0;
+}
+
+bool SharedFormula::publish(const char* name, uint64_t source, int vars, int clauses, const int* lits, uint64_t n)
+{
+    uint64_t size = sizeof(SharedFormulaHeader) + sizeof(int32_t) * n;
+    int      fd   = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0644);
+    if (fd < 0) return false;
+    char* m = ftruncate(fd, size) == 0 ? (char*)mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0) : (char*)MAP_FAILED;
+    ::close(fd);
+    if (m == MAP_FAILED) {
+        shm_unlink(name);
+        return false; }
+
+    SharedFormulaHeader h;
+    memset(&h, 0, sizeof(h));
+    h.version = Version;
+    h.vars    = vars;
+    h.clauses = clauses;
+    h.source  = source;
+    h.nLits   = n;
+    h.size    = size;
+    for (uint64_t i = 0; i < n; i++)
+        if (abs(lits[i]) > h.maxVar) h.maxVar = abs(lits[i]);
+    memcpy(m, &h, sizeof(h));
+    memcpy(m + sizeof(h), lits, sizeof(int32_t) * n);
+    std::atomic_thread_fence(std::memory_order_release);
+    storeMagic(m, formMagic);
+    munmap(m, size);
+    return true;
+}
+
+void SharedFormula::remove(const char* name) { shm_unlink(name); }
+
+uint64_t SharedFormula::sourceKey(const char* path)
+{
+    struct stat st;
+    if (stat(path, &st) != 0 || !S_ISREG(st.st_mode)) return 0;
+    uint64_t h = hashMix(0, Version);
+    h = hashMix(h, st.st_dev);
+    h = hashMix(h, st.st_ino);
+    h = hashMix(h, st.st_size);
+    h = hashMix(h, st.st_mtim.tv_sec);
+    h = hashMix(h, st.st_mtim.tv_nsec);
+    return h;
+}
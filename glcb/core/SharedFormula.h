@@ -0,0 +1,73 @@
+/*********************************************************************************[SharedFormula.h]
+ Parsed formula in a named POSIX shared-memory segment (-shm), so that the processes started on
+ the same instance parse it once: the first one publishes the literal stream of the file, the next
+ ones attach the segment read-only and add the clauses straight from it.
+
+ Layout (native endianness, version 'SharedFormula::Version'):
+
+     header     SharedFormulaHeader                   (64 bytes)
+     int32      lits[nLits]                           (DIMACS literals, every clause terminated by 0)
+
+ The segment is keyed by the identity of the input file (device, inode, size and modification
+ time), which is known without reading it.
+
+ Same licence as the rest of Glucose (see LICENCE).
+ **************************************************************************************************/
+
+#ifndef Glucose_SharedFormula_h
+#define Glucose_SharedFormula_h
+
+#include <stdint.h>
+
+namespace Glucose {
+
+struct SharedFormulaHeader {
+    char     magic[8];     // "GLCBFORM", written last
+    uint32_t version;
+    int32_t  vars;         // Numbers of the "p cnf" header.
+    int32_t  clauses;
+    int32_t  maxVar;       // Largest variable of 'lits' (may exceed 'vars').
+    uint64_t source;       // 'SharedFormula::sourceKey' of the input file.
+    uint64_t nLits;
+    uint64_t size;         // Total segment size.
+    char     pad[16];
+};
+
+//=================================================================================================
+// SharedFormula -- a read-only mapping of a formula segment:
+
+class SharedFormula {
+    void*    image;
+    uint64_t mapSize;
+
+public:
+    enum { Version = 2 };
+    enum Status { Missing, Invalid, Stale, Attached };
+
+    int             vars;
+    int             clauses;
+    const int32_t*  lits;
+    uint64_t        nLits;
+
+    SharedFormula() : image(NULL), mapSize(0), vars(0), clauses(0), lits(NULL), nLits(0) { }
+    ~SharedFormula() { close(); }
+
+    // Maps the segment 'name' ("/.."). Anything but 'Attached' leaves the object empty: 'Invalid'
+    // also covers a segment still being published and literals beyond 'maxVar', 'Stale' a segment
+    // of another version of the file or of the layout.
+    Status attach(const char* name, uint64_t source);
+    void   close ();
+
+    // Creates the segment 'name'; FALSE if it exists already or on error. The magic is written
+    // last, so that attaching in the meantime gives 'Invalid'.
+    static bool publish(const char* name, uint64_t source, int vars, int clauses, const int* lits, uint64_t n);
+    static void remove (const char* name);
+
+    // Identity of the file 'path', 0 if it is not a regular file.
+    static uint64_t sourceKey(const char* path);
+};
+
+//=================================================================================================
+}
+
+#endif
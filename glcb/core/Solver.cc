@@ -47,11 +47,21 @@ OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWA
  **************************************************************************************************/
 
 #include <math.h>
+#include <atomic>
 
 #include "utils/System.h"
 #include "mtl/Sort.h"
 #include "core/Solver.h"
 #include "core/Constants.h"
+#include "core/Graph.h"
+#include "core/Community.h"
+#include "core/Centrality.h"
+#include "core/Metadata.h"
+#include "core/Portfolio.h"
+#include "core/Cubes.h"
+#include "core/Async.h"
+#include "core/Proof.h"
+#include "utils/Threads.h"
 
 #include <stdio.h>
 #include "string.h"
@@ -93,9 +103,28 @@ static IntOption opt_phase_saving(_cat, "phase-saving", "Controls the level of p
 static BoolOption opt_rnd_init_act(_cat, "rnd-init", "Randomize the initial activity", false);
 static DoubleOption opt_garbage_frac(_cat, "gc-frac", "The fraction of wasted memory allowed before a garbage collection is triggered", 0.20, DoubleRange(0, false, HUGE_VAL, false));
 
-static StringOption  opt_cmty_file         (_cat, "cmty-file",   "The community file.");
-static StringOption  opt_cnf_file         (_cat, "cnf-file",   "The cnf file.");
-static StringOption  opt_center_file         (_cat, "center-file",   "The centrality file.");
+static StringOption  opt_cmty_file         (_cat, "cmty-file",   "The community file (if omitted, communities are detected in-process with Louvain).");
+static StringOption  opt_cnf_file         (_cat, "cnf-file",   "Ignored: degrees are computed from the clauses in memory (kept for older scripts).");
+static StringOption  opt_meta_file         (_cat, "meta-file", "Binary metadata file (communities, bridges, community centralities): loaded if it matches the formula and settings, written otherwise.");
+static StringOption  opt_center_file         (_cat, "center-file",   "The centrality file (if omitted, community betweenness is computed in-process).");
+static IntOption     opt_center_length     (_cat, "center-length", "Edge length for in-process betweenness, from the number w of clauses joining two communities (0=1/w, 1=1/w^2)", 1, IntRange(0, 1));
+static IntOption     opt_center_level      (_cat, "center-level", "Centrality of a variable (0=betweenness of its community, 1=its own betweenness, approximated by path sampling)", 0, IntRange(0, 1));
+static DoubleOption  opt_vcenter_eps       (_cat, "vcenter-eps", "Error bound of the sampled variable betweenness", 0.05, DoubleRange(0, false, 1, true));
+static DoubleOption  opt_vcenter_delta     (_cat, "vcenter-delta", "Probability of exceeding the error bound of the sampled variable betweenness", 0.1, DoubleRange(0, false, 1, false));
+static DoubleOption  opt_vcenter_time_lim  (_cat, "vcenter-time-lim", "Wall time budget in seconds for sampling variable betweenness (0=no limit)", 10, DoubleRange(0, true, HUGE_VAL, false));
+static StringOption  opt_center_tiers      (_cat, "center-tiers", "Centrality tiers as comma separated percent:multiplier pairs; the top percent of the variables by centrality are high centers, bumped by the multiplier of the narrowest tier holding them", "33.33333333:1.1");
+static StringOption  opt_degree_tiers      (_cat, "degree-tiers", "Degree tiers as for -center-tiers (empty=none); every bump of a variable in a tier is scaled by its multiplier", "");
+#ifndef BUMP_POLICY
+#define BUMP_POLICY 0
+#endif
+static IntOption     opt_bump_policy       (_cat, "bump-policy", "Preferential bumping (0=bridges among the high centers, 1=high centers during the first -center-decisions decisions, 2=bridges scaled by 1+centrality/10, 3=none)", BUMP_POLICY, IntRange(0, 3));
+static IntOption     opt_center_decisions  (_cat, "center-decisions", "Decisions during which high centers are bumped preferentially with -bump-policy=1", 100000, IntRange(0, INT32_MAX));
+static IntOption     opt_search_threads    (_cat, "threads", "Search threads: a portfolio of bump policies and seeds, or cube solvers with -cube-depth (1=sequential, 0=one per core)", 1, IntRange(0, 1024));
+static IntOption     opt_cube_depth        (_cat, "cube-depth", "Cube-and-conquer: depth of the lookahead split on bridges and high centers (0=off)", 0, IntRange(0, 30));
+static IntOption     opt_cube_cands        (_cat, "cube-cands", "Cube-and-conquer: split candidates probed at each node", 64, IntRange(1, INT32_MAX));
+static IntOption     opt_cmty_method       (_cat, "cmty-method", "Community detection without -cmty-file (0=Louvain, 1=parallel label propagation, 2=label propagation above 4.8M clauses)", 2, IntRange(0, 2));
+static IntOption     opt_graph_threads     (_cat, "graph-threads", "Threads used to build graphs, for label propagation and for betweenness centrality (0=one per core)", 0, IntRange(0, 1024));
+static DoubleOption  opt_cmty_time_lim     (_cat, "cmty-time-lim", "Wall time budget in seconds for label propagation (0=no limit)", 120, DoubleRange(0, true, HUGE_VAL, false));
 
 //=================================================================================================
 // Constructor/Destructor:
@@ -126,8 +155,19 @@ verbosity(0)
 , rnd_pol(false)
 , rnd_init_act(opt_rnd_init_act)
 , garbage_frac(opt_garbage_frac)
+, bumpPolicy(opt_bump_policy)
+, centerDecisions(opt_center_decisions)
+, searchThreads(opt_search_threads)
+, cubeDepth(opt_cube_depth)
+, cubeCands(opt_cube_cands)
+, cmtyFile(opt_cmty_file)
+, centerFile(opt_center_file)
+, metaFile(opt_meta_file)
+, metaShm(NULL)
+, checkpointFile(NULL), checkpointKey(0), checkpointEvery(0), checkpointRequested(false)
 , certifiedOutput(NULL)
 , certifiedUNSAT(false) // Not in the first parallel version 
+, certifiedLRAT(false)
 , panicModeLastRemoved(0), panicModeLastRemovedShared(0)
 , useUnaryWatched(false)
 , promoteOneWatchedClause(true)
@@ -168,6 +208,7 @@ verbosity(0)
 , conflict_budget(-1)
 , propagation_budget(-1)
 , asynch_interrupt(false)
+, async(NULL)
 , incremental(false)
 , nbVarsInitialFormula(INT32_MAX)
 , totalTime4Sat(0.)
@@ -177,9 +218,16 @@ verbosity(0)
 
 //Sima
 , bridge_decisions(0), highbridge_decisions(0), highdegree_decisions(0), highcenter_decisions(0), mutual_decisions(0), mutualbrgcenter_decisions(0),mutualhdhc_decisions(0)
+, nbCommunities(0), communityModularity(0), communityTime(0), communityByLPA(false), centralityTime(0), centralitySamples(0), bridgeTime(0)
+, metadataStatus(Metadata::Missing), metadataWritten(false), metadataShmStatus(Metadata::Missing), metadataPublished(false), metadataTime(0)
+, minClauseSize(0), maxClauseSize(0), avgClauseSize(0), degreeTime(0), metadataUpdateTime(0)
 
 {
     MYFLAG = 0;
+    metadataReady = false;
+    metadataRestored = false;
+    metaVars = metaClauses = 0;
+    bumpMultUntil = UINT64_MAX;
     // Initialize only first time. Useful for incremental solving (not in // version), useless otherwise
     // Kept here for simplicity
     lbdQueue.initSize(sizeLBDQueue);
@@ -217,8 +265,19 @@ Solver::Solver(const Solver &s) :
 , rnd_pol(s.rnd_pol)
 , rnd_init_act(s.rnd_init_act)
 , garbage_frac(s.garbage_frac)
+, bumpPolicy(s.bumpPolicy)
+, centerDecisions(s.centerDecisions)
+, searchThreads(s.searchThreads)
+, cubeDepth(s.cubeDepth)
+, cubeCands(s.cubeCands)
+, cmtyFile(s.cmtyFile)
+, centerFile(s.centerFile)
+, metaFile(s.metaFile)
+, metaShm(s.metaShm)
+, checkpointFile(NULL), checkpointKey(0), checkpointEvery(0), checkpointRequested(false)   // Clones do not write checkpoints.
 , certifiedOutput(NULL)
 , certifiedUNSAT(false) // Not in the first parallel version 
+, certifiedLRAT(false)
 , panicModeLastRemoved(s.panicModeLastRemoved), panicModeLastRemovedShared(s.panicModeLastRemovedShared)
 , useUnaryWatched(s.useUnaryWatched)
 , promoteOneWatchedClause(s.promoteOneWatchedClause)
@@ -235,6 +294,12 @@ Solver::Solver(const Solver &s) :
 , lastblockatrestart(s.lastblockatrestart)
 , dec_vars(s.dec_vars), clauses_literals(s.clauses_literals)
 , learnts_literals(s.learnts_literals), max_literals(s.max_literals), tot_literals(s.tot_literals)
+, nbCommunities(s.nbCommunities), communityModularity(s.communityModularity), communityTime(s.communityTime)
+, communityByLPA(s.communityByLPA), centralityTime(s.centralityTime), centralitySamples(s.centralitySamples)
+, bridgeTime(s.bridgeTime)
+, metadataStatus(s.metadataStatus), metadataWritten(s.metadataWritten), metadataShmStatus(s.metadataShmStatus), metadataPublished(s.metadataPublished), metadataTime(s.metadataTime)
+, minClauseSize(s.minClauseSize), maxClauseSize(s.maxClauseSize), avgClauseSize(s.avgClauseSize), degreeTime(s.degreeTime)
+, metadataUpdateTime(s.metadataUpdateTime)
 , curRestart(s.curRestart)
 
 , ok(true)
@@ -257,7 +322,8 @@ Solver::Solver(const Solver &s) :
 //
 , conflict_budget(s.conflict_budget)
 , propagation_budget(s.propagation_budget)
-, asynch_interrupt(s.asynch_interrupt)
+, asynch_interrupt(s.interrupted())
+, async(NULL)
 , incremental(s.incremental)
 , nbVarsInitialFormula(s.nbVarsInitialFormula)
 , totalTime4Sat(s.totalTime4Sat)
@@ -271,6 +337,12 @@ Solver::Solver(const Solver &s) :
 
     // Initialize  other variables
      MYFLAG = 0;
+    // The graph metadata is copied as computed by 's', not recomputed.
+    metadataReady = s.metadataReady;
+    metadataRestored = s.metadataRestored;
+    metaVars      = s.metaVars;
+    metaClauses   = s.metaClauses;
+    bumpMultUntil = s.bumpMultUntil;
     // Initialize only first time. Useful for incremental solving (not in // version), useless otherwise
     // Kept here for simplicity
     sumLBD = s.sumLBD;
@@ -292,6 +364,35 @@ Solver::Solver(const Solver &s) :
     s.clauses.memCopyTo(clauses);
     s.learnts.memCopyTo(learnts);
 
+    //Sima
+    s.bridges.memCopyTo(bridges);
+    s.cmtys.memCopyTo(cmtys);
+    s.cmtystruct.memCopyTo(cmtystruct);
+    s.cmtybridges.memCopyTo(cmtybridges);
+    s.cmtydec.memCopyTo(cmtydec);
+    s.literaldecisions.memCopyTo(literaldecisions);
+    s.numbridges.memCopyTo(numbridges);
+    s.sortednumbridges.memCopyTo(sortednumbridges);
+    s.highdegree.memCopyTo(highdegree);
+    s.highcenter.memCopyTo(highcenter);
+    s.centerBump.memCopyTo(centerBump);
+    s.degree.memCopyTo(degree);
+    s.occurrences.memCopyTo(occurrences);
+    s.degreeBump.memCopyTo(degreeBump);
+    s.bumpMult.memCopyTo(bumpMult);
+    s.bridgearrangedliterals.memCopyTo(bridgearrangedliterals);
+    s.arrangedliteraldecisions.memCopyTo(arrangedliteraldecisions);
+    s.sorteddecisions.memCopyTo(sorteddecisions);
+    s.sorted_central_vars.memCopyTo(sorted_central_vars);
+    s.centrality.memCopyTo(centrality);
+    s.sortedcentrality.memCopyTo(sortedcentrality);
+    s.cmtycentrality.memCopyTo(cmtycentrality);
+    s.metaAdded.memCopyTo(metaAdded);
+    s.hintCmty.memCopyTo(hintCmty);
+    s.hintCentrality.memCopyTo(hintCentrality);
+    s.hintBridge.memCopyTo(hintBridge);
+    s.hintPriority.memCopyTo(hintPriority);
+
     s.lbdQueue.copyTo(lbdQueue);
     s.trailQueue.copyTo(trailQueue);
 
@@ -316,6 +417,10 @@ void Solver::initNbInitialVars(int nb) {
   nbVarsInitialFormula = nb;
 }
 
+void Solver::initNbInitialClauses(int nb) {
+  if (certifiedLRAT) certifiedOutput->setInputs(nb);
+}
+
 bool Solver::isIncremental() {
   return incremental;
 }
@@ -342,6 +447,8 @@ Var Solver::newVar(bool sign, bool dvar) {
     activity .push(rnd_init_act ? drand(random_seed) * 0.00001 : 0);
     seen .push(0);
     permDiff .push(0);
+    trailIndex .push(0);
+    unitIds .push(0);
     polarity .push(sign);
     decision .push();
     trail .capacity(v + 1);
@@ -349,6 +456,7 @@ Var Solver::newVar(bool sign, bool dvar) {
 
 //sima
     highcenter .push(false);
+    centerBump .push(1);
     
 	//Lucy
 	centrality   .push(0) ;		
@@ -361,9 +469,12 @@ Var Solver::newVar(bool sign, bool dvar) {
     bridges  .push(false);
     numbridges  .push(0);
     sortednumbridges .push();
-    //highdegree  .push(false);
+    highdegree  .push(false);
+    bumpMult    .push(1);
+    degreeBump  .push(1);
     literaldecisions  .push(0);
-    //degree    .push(0) ;
+    degree    .push(0) ;
+    occurrences .push(0) ;
     cmtystruct  .push(0);
     cmtybridges  .push(0);
     //cmtyhigh  .push(0); //high degree
@@ -385,6 +496,7 @@ Var Solver::newVar(bool sign, bool dvar) {
 bool Solver::addClause_(vec<Lit>& ps) {
 
     assert(decisionLevel() == 0);
+    uint64_t id = certifiedLRAT ? lratInput() : 0;
     if (!ok) return false;
 
     // Check if clause is satisfied and remove false/duplicate literals:
@@ -410,27 +522,38 @@ bool Solver::addClause_(vec<Lit>& ps) {
             ps[j++] = p = ps[i];
     ps.shrink(i - j);
 
-    if (flag && (certifiedUNSAT)) {
-        for (i = j = 0, p = lit_Undef; i < ps.size(); i++)
-            fprintf(certifiedOutput, "%i ", (var(ps[i]) + 1) * (-2 * sign(ps[i]) + 1));
-        fprintf(certifiedOutput, "0\n");
-
-        fprintf(certifiedOutput, "d ");
-        for (i = j = 0, p = lit_Undef; i < oc.size(); i++)
-            fprintf(certifiedOutput, "%i ", (var(oc[i]) + 1) * (-2 * sign(oc[i]) + 1));
-        fprintf(certifiedOutput, "0\n");
+    if (certifiedLRAT) {
+        if (ps.size() < oc.size() || ps.size() == 0) {     // Without its false literals, from the root facts:
+            lratHints.clear();
+            for (i = 0; i < oc.size(); i++)
+                if (value(oc[i]) == l_False) lratHints.push(unitIds[var(oc[i])]);
+            lratHints.push(id);
+            uint64_t input = id;
+            id = certifiedOutput->lemma(ps, lratHints);
+            certifiedOutput->drop(input);
+        }
+    } else if (flag && (certifiedUNSAT)) {
+        certifiedOutput->add(ps);
+        certifiedOutput->remove(oc);
     }
 
 
     if (ps.size() == 0)
         return ok = false;
     else if (ps.size() == 1) {
+        if (certifiedLRAT) unitIds[var(ps[0])] = id;
         uncheckedEnqueue(ps[0]);
-        return ok = (propagate() == CRef_Undef);
+        CRef confl = propagate();
+        if (certifiedLRAT && confl != CRef_Undef) lratEmpty(confl);
+        return ok = (confl == CRef_Undef);
     } else {
         CRef cr = ca.alloc(ps, false);
+        if (certifiedLRAT) ca.setId(cr, id);
         clauses.push(cr);
         attachClause(cr);
+        if (metadataReady) {    // Kept for 'updateMetadata'.
+            for (i = 0; i < ps.size(); i++) metaAdded.push(ps[i]);
+            metaAdded.push(lit_Undef); }
     }
 
     return true;
@@ -503,12 +626,10 @@ void Solver::removeClause(CRef cr, bool inPurgatory) {
 
     Clause& c = ca[cr];
 
-    if (certifiedUNSAT) {
-        fprintf(certifiedOutput, "d ");
-        for (int i = 0; i < c.size(); i++)
-            fprintf(certifiedOutput, "%i ", (var(c[i]) + 1) * (-2 * sign(c[i]) + 1));
-        fprintf(certifiedOutput, "0\n");
-    }
+    if (certifiedLRAT)
+        certifiedOutput->drop(ca.id(cr));
+    else if (certifiedUNSAT)
+        certifiedOutput->remove(c);
 
     if (inPurgatory)
         detachClausePurgatory(cr);
@@ -624,6 +745,9 @@ void Solver::minimisationWithBinaryResolution(vec<Lit> &out_learnt) {
             if (permDiff[var(imp)] == MYFLAG && value(imp) == l_True) {
                 nb++;
                 permDiff[var(imp)] = MYFLAG - 1;
+                if (certifiedLRAT) {    // 'imp' now follows from 'p' alone, first in the hints.
+                    lratSteps.push(wbin[k].cref);
+                    seen[var(imp)] = 0; }
             }
         }
         int l = out_learnt.size() - 1;
@@ -706,7 +830,21 @@ Lit Solver::pickBranchLit() {
 |      * If out_learnt.size() > 1 then 'out_learnt[1]' has the greatest decision level of the 
 |        rest of literals. There may be others from the same level though.
 |  
+|  
+|    The bump policy is a template parameter: every policy is instantiated and 'analyze' picks
+|    the one of 'bumpPolicy'. Except with 'BumpNone', a bump is scaled by 'bumpMult'.
 |________________________________________________________________________________________________@*/
+void Solver::analyze(CRef confl, vec<Lit>& out_learnt,vec<Lit>&selectors, int& out_btlevel,unsigned int &lbd,unsigned int &szWithoutSelectors) {
+    if (decisions >= bumpMultUntil) computeBumpMult();
+    switch (bumpPolicy) {
+    case BumpBridgeCenter: analyze<BumpBridgeCenter>(confl, out_learnt, selectors, out_btlevel, lbd, szWithoutSelectors); break;
+    case BumpCenterEarly:  analyze<BumpCenterEarly> (confl, out_learnt, selectors, out_btlevel, lbd, szWithoutSelectors); break;
+    case BumpBridgeScaled: analyze<BumpBridgeScaled>(confl, out_learnt, selectors, out_btlevel, lbd, szWithoutSelectors); break;
+    default:               analyze<BumpNone>        (confl, out_learnt, selectors, out_btlevel, lbd, szWithoutSelectors); break;
+    }
+}
+
+template<int Policy>
 void Solver::analyze(CRef confl, vec<Lit>& out_learnt,vec<Lit>&selectors, int& out_btlevel,unsigned int &lbd,unsigned int &szWithoutSelectors) {
     int pathC = 0;
     Lit p = lit_Undef;
@@ -716,8 +854,11 @@ void Solver::analyze(CRef confl, vec<Lit>& out_learnt,vec<Lit>&selectors, int& o
     //
     out_learnt.push(); // (leave room for the asserting literal)
     int index = trail.size() - 1;
+    if (certifiedLRAT) lratSteps.clear();
     do {
         assert(confl != CRef_Undef); // (otherwise should be UIP)
+        if (certifiedLRAT)          // Keyed by the trail index of the literal derived, the conflict last:
+            lratSteps.push((uint64_t)(p == lit_Undef ? trail.size() + 1 : trailIndex[var(p)] + 1) << 32 | confl);
         Clause& c = ca[confl];
         // Special case for binary clauses
         // The first one has to be SAT
@@ -758,13 +899,10 @@ void Solver::analyze(CRef confl, vec<Lit>& out_learnt,vec<Lit>&selectors, int& o
                 if (level(var(q)) == 0) {
                 } else { // Here, the old case 
                     if(!isSelector(var(q))){
-                        if (highcenter[var(q)] && bridges[var(q)]) { //Lucy 
-                        	//fprintf(stdout, "High center %d\n", var(q));
-                        	varBumpActivity(var(q), (var_inc * 1.1));
-						}                        
-						else {
-                            varBumpActivity(var(q));                                    
-						}
+                        if (Policy == BumpNone)
+                            varBumpActivity(var(q));
+                        else
+                            varBumpActivity(var(q), var_inc * bumpMult[var(q)]); //Lucy
                     }                   
                     seen[var(q)] = 1;
                     if (level(var(q)) >= decisionLevel()) {
@@ -882,6 +1020,8 @@ void Solver::analyze(CRef confl, vec<Lit>& out_learnt,vec<Lit>&selectors, int& o
 
 
 
+    if (certifiedLRAT) lratAnalyzeHints(out_learnt);
+
     for (int j = 0; j < analyze_toclear.size(); j++) seen[var(analyze_toclear[j])] = 0; // ('seen[]' is now cleared)
     for (int j = 0; j < selectors.size(); j++) seen[var(selectors[j])] = 0;
 }
@@ -972,6 +1112,9 @@ void Solver::uncheckedEnqueue(Lit p, CRef from) {
     assert(value(p) == l_Undef);
     assigns[var(p)] = lbool(!sign(p));
     vardata[var(p)] = mkVarData(from, decisionLevel());
+    if (certifiedLRAT) {
+        trailIndex[var(p)] = trail.size();
+        if (decisionLevel() == 0 && from != CRef_Undef) lratRootUnit(p, from); }
     trail.push_(p);
 }
 
@@ -1266,56 +1409,6 @@ void Solver::rebuildOrderHeap() {
 
 }
 
-//SIMA
-
-void wsortingtwo(double* number, int* pointnumber, int n){
-
-     /*Sort the given array number , of length n*/     
-
-    double temp=0;
-    int pointtemp = 0;
-        for(int i=1;i<n;i++)
-        {
-            for(int j=0;j<n-i;j++)
-            {
-                if(number[j] >number[j+1])
-                {
-                    temp=number[j];
-                    number[j]=number[j+1];
-                    number[j+1]=temp;
-                    
-                    pointtemp= pointnumber[j] ;
-                    pointnumber[j]=pointnumber[j+1];
-                    pointnumber[j+1]=pointtemp;
-                }
-            }
-        }
-    }
-
-void sortingtwo(int* number, int* pointnumber, int n){
-
-     /*Sort the given array number , of length n*/     
-
-    int temp=0;
-    int pointtemp = 0;
-        for(int i=1;i<n;i++)
-        {
-            for(int j=0;j<n-i;j++)
-            {
-                if(number[j] >number[j+1])
-                {
-                    temp=number[j];
-                    number[j]=number[j+1];
-                    number[j+1]=temp;
-                    
-                    pointtemp= pointnumber[j] ;
-                    pointnumber[j]=pointnumber[j+1];
-                    pointnumber[j+1]=pointtemp;
-                }
-            }
-        }
-    }
-
 /*_________________________________________________________________________________________________
 |
 |  simplify : [void]  ->  [bool]
@@ -1331,6 +1424,7 @@ bool Solver::simplify() {
     else {
         CRef cr = propagate();
         if (cr != CRef_Undef) {
+            if (certifiedLRAT) lratEmpty(cr);
             return ok = false;
         }
     }
@@ -1386,7 +1480,9 @@ lbool Solver::search(int nof_conflicts) {
         CRef confl = propagate();
 
         if (confl != CRef_Undef) {
-            if(parallelJobIsFinished())
+            if(parallelJobIsFinished() || !withinBudget())   // Budgets and interrupts hold per conflict
+                return l_Undef;
+            if (async != NULL && (conflicts & 63) == 0 && !async->tick())
                 return l_Undef;
                
             sumDecisionLevels += decisionLevel();
@@ -1404,6 +1500,7 @@ lbool Solver::search(int nof_conflicts) {
                         (int) nbReduceDB, nLearnts(), (int) nbDL2, (int) nbRemovedClauses, progressEstimate()*100);
             }
             if (decisionLevel() == 0) {
+                if (certifiedLRAT) lratEmpty(confl);
                 return l_False;
 
             }
@@ -1427,20 +1524,21 @@ lbool Solver::search(int nof_conflicts) {
             sumLBD += nblevels;
 
             cancelUntil(backtrack_level);
-            if (certifiedUNSAT) {
-                for (int i = 0; i < learnt_clause.size(); i++)
-                    fprintf(certifiedOutput, "%i ", (var(learnt_clause[i]) + 1) *
-                        (-2 * sign(learnt_clause[i]) + 1));
-                fprintf(certifiedOutput, "0\n");
-            }
+            uint64_t id = 0;
+            if (certifiedLRAT)
+                id = certifiedOutput->lemma(learnt_clause, lratHints);
+            else if (certifiedUNSAT)
+                certifiedOutput->add(learnt_clause);
 
 
             if (learnt_clause.size() == 1) {
+                if (certifiedLRAT) unitIds[var(learnt_clause[0])] = id;
                 uncheckedEnqueue(learnt_clause[0]);
                 nbUn++;
                 parallelExportUnaryClause(learnt_clause[0]);
             } else {
                 CRef cr = ca.alloc(learnt_clause, true);
+                if (certifiedLRAT) ca.setId(cr, id);
                 ca[cr].setLBD(nblevels);
                 ca[cr].setOneWatched(false);
 		ca[cr].setSizeWithoutSelectors(szWithoutSelectors);
@@ -1509,7 +1607,8 @@ lbool Solver::search(int nof_conflicts) {
                 decisions++;
                 next = pickBranchLit();
                 if (next == lit_Undef) {
-                    printf("c last restart ## conflicts  :  %d %d \n", conflictC, decisionLevel());
+                    if (verbosity >= 1)
+                        printf("c last restart ## conflicts  :  %d %d \n", conflictC, decisionLevel());
                     // Model found:
                     return l_True;
                 }
@@ -1527,11 +1626,11 @@ lbool Solver::search(int nof_conflicts) {
 
                 literaldecisions[var(next)]++ ;
                 if (bridges[var(next)]) bridge_decisions++;
-                //if (highdegree[var(next)]) highdegree_decisions++;
-                //if (highdegree[var(next)] && bridges[var(next)]) mutual_decisions++;
+                if (highdegree[var(next)]) highdegree_decisions++;
+                if (highdegree[var(next)] && bridges[var(next)]) mutual_decisions++;
                 if (highcenter[var(next)]) highcenter_decisions++;
                 if (highcenter[var(next)] && bridges[var(next)]) mutualbrgcenter_decisions++;
-                //if (highcenter[var(next)] && highdegree[var(next)]) mutualhdhc_decisions++;
+                if (highcenter[var(next)] && highdegree[var(next)]) mutualhdhc_decisions++;
                 cmtydec[cmtys[var(next)]]++ ;
 
             
@@ -1587,140 +1686,261 @@ lbool Solver::solve_(bool do_simp, bool turn_off_simp) // Parameters are useless
     exit(-1);
   }
 
-//Sima
-  //////////////////////////THE ORIGINAL CODE BLOCK////////////////////////////////
-    if (!opt_cmty_file)
-        fprintf(stderr, "missing community file\n"), exit(1);
-    FILE* cmty_file = fopen(opt_cmty_file, "r");
-    if (cmty_file == NULL)
-        fprintf(stderr, "could not open file %s\n", (const char*) opt_cmty_file), exit(1);
-
-    //vec<int> cmtys (nVars());
-    //vec<int> sortedDegree (nVars()) ;
+    initMetadata(); //Sima
+
+    model.clear();
+    conflict.clear();
+    if (!ok) return l_False;
+    double curTime = cpuTime();
+
+    solves++;
+            
+   
+    
+    lbool   status        = l_Undef;
+    if(!incremental && verbosity>=1) {
+      printf("c ========================================[ MAGIC CONSTANTS ]==============================================\n");
+      printf("c | Constants are supposed to work well together :-)                                                      |\n");
+      printf("c | however, if you find better choices, please let us known...                                           |\n");
+      printf("c |-------------------------------------------------------------------------------------------------------|\n");
+      printf("c |                                |                                |                                     |\n"); 
+      printf("c | - Restarts:                    | - Reduce Clause DB:            | - Minimize Asserting:               |\n");
+      printf("c |   * LBD Queue    : %6d      |   * First     : %6d         |    * size < %3d                     |\n",lbdQueue.maxSize(),nbclausesbeforereduce,lbSizeMinimizingClause);
+      printf("c |   * Trail  Queue : %6d      |   * Inc       : %6d         |    * lbd  < %3d                     |\n",trailQueue.maxSize(),incReduceDB,lbLBDMinimizingClause);
+      printf("c |   * K            : %6.2f      |   * Special   : %6d         |                                     |\n",K,specialIncReduceDB);
+      printf("c |   * R            : %6.2f      |   * Protected :  (lbd)< %2d     |                                     |\n",R,lbLBDFrozenClause);
+      printf("c |                                |                                |                                     |\n"); 
+      printf("c ==================================[ Search Statistics (every %6d conflicts) ]=========================\n",verbEveryConflicts);
+      printf("c |                                                                                                       |\n"); 
+
+      printf("c |          RESTARTS           |          ORIGINAL         |              LEARNT              | Progress |\n");
+      printf("c |       NB   Blocked  Avg Cfc |    Vars  Clauses Literals |   Red   Learnts    LBD2  Removed |          |\n");
+      printf("c =========================================================================================================\n");
+    }
+
+    // Search:
+    int  curr_restarts = 0;
+    int  nthreads      = certifiedUNSAT ? 1 : effectiveThreads(searchThreads);
+    bool parallel      = false;   // The model was copied from another solver.
+    if (cubeDepth > 0 && assumptions.size() == 0 && !certifiedUNSAT) {
+        CubeAndConquer cubes(*this, nthreads, cubeDepth, cubeCands);
+        status   = cubes.solve();
+        parallel = true;
+        if (verbosity >= 1)
+            printf("c cubes                 : %d on %d threads (%d refuted by lookahead, %d solved UNSAT), cubing %g s\n",
+                   cubes.nCubes, nthreads, cubes.nRefuted, cubes.nSolved, cubes.cubeTime);
+    } else if (nthreads > 1) {
+        Portfolio portfolio(*this, nthreads);
+        status   = portfolio.solve(assumptions);
+        parallel = true;
+        if (verbosity >= 1)
+            printf("c portfolio             : %d threads, won by bump policy %d, %" PRIu64" clauses shared, %" PRIu64" imported\n",
+                   nthreads, portfolio.winnerPolicy, portfolio.exported, portfolio.imported);
+    } else {
+    uint64_t nextCheckpoint = conflicts + checkpointEvery;
+    while (status == l_Undef){
+      status = search(0); // the parameter is useless in glucose, kept to allow modifications
+
+        if (!withinBudget()) break;
+        curr_restarts++;
+
+        // Checkpoint between two restarts, when due or requested:
+        if (status == l_Undef && checkpointFile && decisionLevel() == 0
+            && (checkpointRequested || (checkpointEvery > 0 && conflicts >= nextCheckpoint))) {
+            checkpointRequested = false;
+            nextCheckpoint      = conflicts + checkpointEvery;
+            if (!saveCheckpoint(checkpointFile, checkpointKey))
+                fprintf(stderr, "could not write checkpoint %s\n", checkpointFile);
+            else if (verbosity >= 1)
+                printf("c checkpoint            : %s at %" PRIu64" conflicts\n", checkpointFile, conflicts);
+        }
+    }
+    }
+
+	//Removed by Lucy
+	/*
+    FILE *fp11, *fp13 ;
+    char *dr1, *dr3 ;
+
+    dr1 = (char*)malloc((strlen((const char*)opt_cnf_file)+4+1)*sizeof(char));
+    strcpy(dr1, (const char*)opt_cnf_file);
+    strcat( dr1, ".dg");
+
+    dr3 = (char*)malloc((strlen((const char*)opt_cnf_file)+4+1)*sizeof(char));
+    strcpy(dr3, (const char*)opt_cnf_file);
+    strcat( dr3, ".decf");      
+
+    fp11 = fopen(dr1, "w");
+    fp13 = fopen(dr3, "w");
+
+
+    for (int i = 0 ; i<nVars() ; i++){
+        
+        fprintf(fp11, " %d \t \n", degree[i]  );
+        fprintf(fp13, " %d \t \n", literaldecisions[i]  );
+    }
+
+    fclose(fp11);
+    fclose(fp13);
+	*/
+
+    if (!incremental && verbosity >= 1)
+      printf("c =========================================================================================================\n");
+
+    if (certifiedUNSAT && status == l_False) // Want certified output
+        certifiedOutput->addEmpty();
+
+
+
+    if (status == l_True && !parallel){
+        // Extend & copy model (the portfolio copied the winner's):
+        model.growTo(nVars());
+        for (int i = 0; i < nVars(); i++) model[i] = value(i);
+    }else if (status == l_False && conflict.size() == 0)
+        ok = false;
+
+
+
+    cancelUntil(0);
+
+
+    double finalTime = cpuTime();
+    if(status==l_True) {
+        nbSatCalls++; 
+        totalTime4Sat +=(finalTime-curTime);
+    }
+    if(status==l_False) {
+        nbUnsatCalls++; 
+        totalTime4Unsat +=(finalTime-curTime);
+    }
+    
+
+    return status;
+
+}
+
+
+
+
+
+// Graph hints: copied, and used by the first 'initMetadata' instead of the side files or the detection.
+// Centralities, bridge flags and priorities given after it take effect at once (between solves).
+void Solver::setCommunityHints(const int* cmty, int n) {
+    hintCmty.clear();
+    for (int i = 0; i < n; i++) hintCmty.push(cmty[i]);
+}
+
+void Solver::setCentralityHints(const double* center, int n) {
+    hintCentrality.clear();
+    for (int i = 0; i < n; i++) hintCentrality.push(center[i]);
+    if (metadataReady) applyHints();
+}
+
+void Solver::setBridgeHints(const bool* bridge, int n) {
+    hintBridge.clear();
+    for (int i = 0; i < n; i++) hintBridge.push(bridge[i]);
+    if (metadataReady) applyHints();
+}
+
+void Solver::setPriorityHints(const double* weight, int n) {
+    hintPriority.clear();
+    for (int i = 0; i < n; i++) hintPriority.push(weight[i]);
+    if (metadataReady) applyHints();
+}
+
+void Solver::applyHints() {
+    for (int i = 0; i < hintBridge.size() && i < metaVars; i++)
+        if (bridges[i] != hintBridge[i]) {
+            bridges[i] = hintBridge[i];
+            cmtybridges[cmtys[i]] += bridges[i] ? 1 : -1; }
+    if (hintCentrality.size() > 0)
+        for (int i = 0; i < metaVars; i++)
+            centrality[i] = i < hintCentrality.size() ? hintCentrality[i] : 0;
+    rankCentrality();
+    computeBumpMult();
+}
+
+
+/*_________________________________________________________________________________________________
+|
+|  initMetadata : [void]  ->  [void]
+|  
+|  Description:
+|    Graph metadata stage, run by the first 'solve_': communities (-cmty-file, -meta-file or
+|    detected), bridges, degrees and centralities (-center-file or computed), then the tiers of
+|    preferentially bumped variables. The result is kept in the solver; later calls (every
+|    incremental 'solve_') only extend it to the variables and clauses added since, see
+|    'updateMetadata'. May be called before solving to pay the setup cost up front. Hints given
+|    in memory ('setCommunityHints' etc.) take the place of the files and of the detection, and a
+|    checkpoint restored by 'loadCheckpoint' supplies them the way -meta-file does.
+|________________________________________________________________________________________________@*/
+void Solver::initMetadata() {
+    if (metadataReady) {
+        updateMetadata();
+        return; }
+
     int v;
     int cmty;
-    while (fscanf(cmty_file, "%d %d\n", &v, &cmty) == 2) {
-        cmtys[v] = cmty;
-        cmtystruct[cmty] = cmtystruct[cmty] + 1 ;
-    }
-    for (int i = 0; i < nClauses(); i++) {
-        Clause& c = ca[clauses[i]];
-        if (c.size() > 0) {
-            for (int j = 0; j < c.size(); j++) {
-                Var varJ = var(c[j]);
-                for (int k = j + 1; k < c.size(); k++) {
-                    Var varK = var(c[k]);
-                    if (cmtys[varJ] != cmtys[varK]) {
-                        if (!bridges[varJ])
-                            cmtybridges[cmtys[varJ]]++ ; 
-                        if (!bridges[varK])
-                            cmtybridges[cmtys[varK]]++ ; 
-
-                        bridges[varJ] = true;
-                        bridges[varK] = true;
-                        
-                        numbridges[varJ]++ ;
-                        numbridges[varK]++ ;
-                        
-                    }
-                }
+    bool hinted = hintCmty.size() > 0;
+    bool cached = metadataRestored || (!hinted && loadMetadata());
+    if (!cached) {
+        if (hinted) {
+            for (int i = 0; i < nVars(); i++) {
+                cmty = i < hintCmty.size() && hintCmty[i] >= 0 && hintCmty[i] < nVars() ? hintCmty[i] : 0;
+                cmtys[i] = cmty;
+                cmtystruct[cmty]++;
+                if (cmty >= nbCommunities) nbCommunities = cmty + 1;
             }
-        }
+        } else if (cmtyFile) {
+            FILE* cmty_file = fopen(cmtyFile, "r");
+            if (cmty_file == NULL)
+                fprintf(stderr, "could not open file %s\n", cmtyFile), exit(1);
+
+            while (fscanf(cmty_file, "%d %d\n", &v, &cmty) == 2) {
+                cmtys[v] = cmty;
+                cmtystruct[cmty] = cmtystruct[cmty] + 1 ;
+                if (cmty >= nbCommunities) nbCommunities = cmty + 1;
+            }
+            fclose(cmty_file);
+        } else
+            detectCommunities();
+
+        detectBridges();
     }
+    for (int i = 0; i < hintBridge.size() && i < nVars(); i++)
+        if (bridges[i] != hintBridge[i]) {
+            bridges[i] = hintBridge[i];
+            cmtybridges[cmtys[i]] += bridges[i] ? 1 : -1; }
     int nBridges = 0;
     for (int i = 0; i < bridges.size(); i++) {
         if (bridges[i]) nBridges++;
     }
-    fclose(cmty_file);
 /////////////////////////////////////THE COPIED CNF VERSION [ADDED BY SIMA]//////////////////
 
 
-    int cnt ;
-
-   //fprintf(stdout, "gggg \t\t\t %d \n", degree[3]) ;
-   if (!opt_cnf_file)
-        fprintf(stderr, "missing cnf file\n"), exit(1);
-    FILE* cnf_file = fopen(opt_cnf_file, "r");
-    if (cnf_file == NULL)
-        fprintf(stderr, "could not open file %s\n", (const char*) opt_cnf_file), exit(1);
-
-    char line[10024]; 
-    int dgt, litcnt ;  
-    //double clauselength, one=1 ;
-    bool flag ;                                                                                             
-    
-    //Removed by Lucy
-    /*
-    while(fgets(line, sizeof line, cnf_file)) {                                                                     
-        if (line[0] != 'c' && line[0] != 'p' ) {  
-            cnt = 0;  
-            litcnt = 0;                                                         
-            while ( line[cnt] != ' ' || line[cnt+1] != '0' ) {
-                flag = false;
-                while (line[cnt] != ' ' && line[cnt] != '-') {
-                    flag = true ;
-                    cnt = cnt + 1 ;
-                }
-            if (flag)   {
-                litcnt++ ;
-                }
-            else   cnt = cnt + 1 ;
-            } 
-            //fprintf(stdout,"literalllsss  \t\t   %d \n ", litcnt) ;  
-            cnt = 0 ;
-            //clauselength = 0 ;
-            //if (litcnt > 1)
-            //clauselength = one/(litcnt - 1) ;
-            //fprintf(stdout,"clause length  \t\t   %f \n ", clauselength) ;  
-            while ( line[cnt] != ' ' || line[cnt+1] != '0' ) {
-                v = 0 ;
-                flag = false ;
-                while (line[cnt] != ' ' && line[cnt] != '-') {
-                    dgt = line[cnt] - '0' ;
-                    v= v*10 + dgt ;
-                    flag = true ;
-                    cnt = cnt + 1 ;
-                }
-            if (flag)   {
-                //varfreq[v-1] = varfreq[v-1] +1 ;
-                degree[v-1] = degree[v-1] + litcnt -1 ;
-                }
-            else   cnt = cnt + 1 ;
-            }                                       
-        }                                                                                                          
-                                                
-    } 
-    fclose(cnf_file); 
-    */
+    computeDegrees();
 
 
 // **************** centrality file ****************
-    if (!opt_center_file)
-        fprintf(stderr, "missing centrality file\n"), exit(1);
-    FILE* center_file = fopen(opt_center_file, "r");
-    if (center_file == NULL)
-        fprintf(stderr, "could not open file %s\n", (const char*) opt_center_file), exit(1);
-
-    
-
-	double center; 
-	//cnt = 0 ;
-    //while (fscanf(center_file, "%d %lf\n", &v, &center) == 2) {
-	while (fscanf(center_file, "%d %lf\n", &cmty, &center) == 2) {	//Lucy
-		//center = center * 1000 ;
-        //fprintf(stdout, " centrality sort vars \t\t   %f \n ",  center)  ;
-        //centrality[v] = center;
-        //sorted_central_vars[cnt] = v ;
-        //cnt++ ;
-        //fprintf(stdout, " centrality sort vars \t\t   %d \t %d \t %d \t %f \n ", cnt, v,  sorted_central_vars[cnt-1], centrality[v])  ; 
-        //printf("bing");
-		
-		//Lucy
-		cmtycentrality[cmty] = center;
-		//fprintf(stdout, " centrality cmty \t\t   %d \t %lf \n", cmty, cmtycentrality[cmty])  ; 
-	
-	}
-    fclose(center_file);
+    double center;
+    if (hintCentrality.size() > 0)
+        ;   // Per variable, below.
+    else if (opt_center_level == 1 && !metadataRestored)
+        computeVarCentrality();
+    else if (!cached && centerFile) {
+        FILE* center_file = fopen(centerFile, "r");
+        if (center_file == NULL)
+            fprintf(stderr, "could not open file %s\n", centerFile), exit(1);
+
+        while (fscanf(center_file, "%d %lf\n", &cmty, &center) == 2) {	//Lucy
+            //fprintf(stdout, " centrality cmty \t\t   %d \t %lf \n", cmty, cmtycentrality[cmty])  ; 
+            cmtycentrality[cmty] = center;
+        }
+        fclose(center_file);
+    } else if (!cached)
+        computeCentrality();
+    if (!cached && !hinted)
+        saveMetadata();
     v= nVars();
     /*for (int i =0 ; i < v ; i++){
         //fprintf(stdout," centrality sort vars \t\t   %d \n ", sorted_central_vars[i]) ; 
@@ -1742,14 +1962,16 @@ lbool Solver::solve_(bool do_simp, bool turn_off_simp) // Parameters are useless
 		//Lucy
 		//IMPORTANT: in .cmty (format: vertex community), the communities start numbering from 0
 		//in the betweeenness centrality file, the communities start numbering from 1
-		centrality[i] = cmtycentrality[cmtys[i]+1];
-		sortedcentrality[i] = centrality[i];
-		sorted_central_vars[i] = i ;
+		if (hintCentrality.size() > 0)
+			centrality[i] = i < hintCentrality.size() ? hintCentrality[i] : 0;
+		else if (opt_center_level == 0)
+			centrality[i] = cmtycentrality[cmtys[i]+1];
 		
      }   
    
    
-   wsortingtwo(sortedcentrality ,sorted_central_vars, v); //Lucy
+   rankCentrality(); //Lucy
+   computeBumpMult();
 
 /*
    for (int i =0 ; i < v ; i++){
@@ -1788,19 +2010,6 @@ lbool Solver::solve_(bool do_simp, bool turn_off_simp) // Parameters are useless
 	*/
 
 
-	int tempnum, tempo ;
-   //tempnum= v-nBridges ;
-   tempnum=  v - (v/3) ;
-
-
-   for (int i =tempnum ; i< v ; i++){
-       //tempo = degreearrangedliterals[i] ;
-       //highdegree[tempo] = true;
-       //cmtyhigh[cmtys[tempo]]++ ; 
-       
-       tempo =  sorted_central_vars[i] ;
-       highcenter[tempo] = true;
-   } 
 
 	/*
    for (int i =0 ; i < highcenter.size() ; i++){
@@ -1817,6 +2026,17 @@ lbool Solver::solve_(bool do_simp, bool turn_off_simp) // Parameters are useless
 	*/
 
 
+	if (verbosity >= 1 && bumpPolicy == BumpCenterEarly) {
+	// The high centers, by increasing centrality (ties by index), as the i_hc code listed them.
+	vec<Var> hc;
+	for (int i = 0 ; i < highcenter.size() ; i++)
+		if (highcenter[i]) hc.push(i);
+	sort(hc, [&](Var x, Var y) { return centrality[x] < centrality[y] || (centrality[x] == centrality[y] && x < y); });
+	printf("Preferentially_bumped : \n");
+	for (int i = 0 ; i < hc.size() ; i++)
+		printf("%d ", hc[i]);
+	printf("\n");
+	} else if (verbosity >= 1 && bumpPolicy == BumpBridgeCenter) {
 	printf("Preferentially_bumped : \n");
 	for (int i = 0 ; i < highcenter.size() ; i++){
 		if (highcenter[i] && bridges[i]) {
@@ -1824,6 +2044,7 @@ lbool Solver::solve_(bool do_simp, bool turn_off_simp) // Parameters are useless
 		}
 	}	
 	printf("\n");
+	}
 
 
     int nHighcenter = 0;
@@ -1849,13 +2070,35 @@ lbool Solver::solve_(bool do_simp, bool turn_off_simp) // Parameters are useless
        }
 */
 
-    printf("Bridges   : %d\n", nBridges);
-//  printf("Highdegrees   : %d\n", nHighdegree);
-    printf("Highcenters   : %d\n", nHighcenter);
-//    printf("Mutual degree   : %d\n", nMutual);
-    printf("Mutualcentralbridge   : %d\n", nMutualbrgcenter);
-//    printf("Mutual central highdegree   : %d\n", nMutualhdcenter);
-    printf("Variables : %d\n", nVars());
+    if (verbosity >= 1) {
+        printf("Bridges   : %d\n", nBridges);
+        printf("Bridge_detection_time   : %g s\n", bridgeTime);
+        printf("Clause_sizes   : min %d avg %.2f max %d\n", minClauseSize, avgClauseSize, maxClauseSize);
+        printf("Degree_time   : %g s\n", degreeTime);
+    //  printf("Highdegrees   : %d\n", nHighdegree);
+        printf("Highcenters   : %d\n", nHighcenter);
+    //    printf("Mutual degree   : %d\n", nMutual);
+        printf("Mutualcentralbridge   : %d\n", nMutualbrgcenter);
+    //    printf("Mutual central highdegree   : %d\n", nMutualhdcenter);
+        printf("Variables : %d\n", nVars());
+        printf("Communities   : %d\n", nbCommunities);
+        if (!cmtyFile && !hinted && !cached) {
+            printf("Community_method   : %s\n", communityByLPA ? "label propagation" : "louvain");
+            printf("Modularity   : %f\n", communityModularity);
+            printf("Community_detection_time   : %g s\n", communityTime);
+        }
+        if (opt_center_level == 1)
+            printf("Centrality_samples   : %d\n", centralitySamples);
+        if (hintCentrality.size() == 0 && (opt_center_level == 1 || (!centerFile && !cached)))
+            printf("Centrality_time   : %g s\n", centralityTime);
+        static const char* status[] = { "missing", "invalid", "stale", "loaded" };
+        if (metaFile)
+            printf("Metadata   : %s%s\n", status[metadataStatus], metadataWritten ? ", written" : "");
+        if (metaShm)
+            printf("Metadata_shm   : %s%s\n", status[metadataShmStatus], metadataPublished ? ", published" : "");
+        if (metaFile || metaShm)
+            printf("Metadata_time   : %g s\n", metadataTime);
+    }
 	/*	
 	printf("Communities_bumped (for bumping variables with normalized centrality scores above a certain cutoff. Communities numbered according to centrality file) : \n");
 	for ( int cmty = 0; cmty < cmtycentrality.size(); cmty++){
@@ -1865,115 +2108,469 @@ lbool Solver::solve_(bool do_simp, bool turn_off_simp) // Parameters are useless
 	}
 	printf("\n");
 	*/
-    
 
- 
-    model.clear();
-    conflict.clear();
-    if (!ok) return l_False;
-    double curTime = cpuTime();
+    metadataReady = true;
+    metaVars      = nVars();
+    metaClauses   = nClauses();
+}
 
-    solves++;
-            
-   
-    
-    lbool   status        = l_Undef;
-    if(!incremental && verbosity>=1) {
-      printf("c ========================================[ MAGIC CONSTANTS ]==============================================\n");
-      printf("c | Constants are supposed to work well together :-)                                                      |\n");
-      printf("c | however, if you find better choices, please let us known...                                           |\n");
-      printf("c |-------------------------------------------------------------------------------------------------------|\n");
-      printf("c |                                |                                |                                     |\n"); 
-      printf("c | - Restarts:                    | - Reduce Clause DB:            | - Minimize Asserting:               |\n");
-      printf("c |   * LBD Queue    : %6d      |   * First     : %6d         |    * size < %3d                     |\n",lbdQueue.maxSize(),nbclausesbeforereduce,lbSizeMinimizingClause);
-      printf("c |   * Trail  Queue : %6d      |   * Inc       : %6d         |    * lbd  < %3d                     |\n",trailQueue.maxSize(),incReduceDB,lbLBDMinimizingClause);
-      printf("c |   * K            : %6.2f      |   * Special   : %6d         |                                     |\n",K,specialIncReduceDB);
-      printf("c |   * R            : %6.2f      |   * Protected :  (lbd)< %2d     |                                     |\n",R,lbLBDFrozenClause);
-      printf("c |                                |                                |                                     |\n"); 
-      printf("c ==================================[ Search Statistics (every %6d conflicts) ]=========================\n",verbEveryConflicts);
-      printf("c |                                                                                                       |\n"); 
 
-      printf("c |          RESTARTS           |          ORIGINAL         |              LEARNT              | Progress |\n");
-      printf("c |       NB   Blocked  Avg Cfc |    Vars  Clauses Literals |   Red   Learnts    LBD2  Removed |          |\n");
-      printf("c =========================================================================================================\n");
+/*_________________________________________________________________________________________________
+|
+|  updateMetadata : [void]  ->  [void]
+|  
+|  Description:
+|    Extends the metadata to the variables created and the problem clauses added ('metaAdded')
+|    since the last call, in time linear in their size plus one re-ranking of the tiers. A new
+|    variable joins the community of the first variable it shares an added clause with, or gets
+|    a community of its own (of centrality 0); the bridges, degrees and clause statistics of the
+|    added clauses are counted as in 'detectBridges' and 'computeDegrees'. Communities and
+|    centralities of the existing variables are not recomputed.
+|________________________________________________________________________________________________@*/
+void Solver::updateMetadata() {
+    if (metaVars == nVars() && metaAdded.size() == 0) return;
+    double start = realTime();
+
+    for (int v = metaVars; v < nVars(); v++) cmtys[v] = -1;
+    for (int i = 0; i < metaAdded.size(); i++) {
+        int c = -1, j;
+        for (j = i; metaAdded[j] != lit_Undef; j++)
+            if (c < 0) c = cmtys[var(metaAdded[j])];
+        for (; i < j; i++)
+            if (cmtys[var(metaAdded[i])] < 0) cmtys[var(metaAdded[i])] = c;
+    }
+    for (int v = metaVars; v < nVars(); v++) {
+        if (cmtys[v] < 0) cmtys[v] = nbCommunities++;
+        cmtystruct[cmtys[v]]++;
     }
+    if (cmtycentrality.size() < nbCommunities + 1)
+        cmtycentrality.growTo(nbCommunities + 1, 0);
+
+    vec<int> hist(nbCommunities, 0);
+    int64_t  lits  = 0;
+    int      added = 0;
+    for (int i = 0; i < metaAdded.size(); i++, added++) {
+        int j = i;
+        while (metaAdded[j] != lit_Undef) j++;
+        int size = j - i;
+        lits += size;
+        if (size < minClauseSize || metaClauses + added == 0) minClauseSize = size;
+        if (size > maxClauseSize) maxClauseSize = size;
+        for (int k = i; k < j; k++) hist[cmtys[var(metaAdded[k])]]++;
+        for (int k = i; k < j; k++) {
+            Var x       = var(metaAdded[k]);
+            int outside = size - hist[cmtys[x]];
+            degree[x]  += size - 1;
+            occurrences[x]++;
+            if (outside == 0) continue;
+            numbridges[x] += outside;
+            if (!bridges[x]) {
+                bridges[x] = true;
+                cmtybridges[cmtys[x]]++;
+            }
+        }
+        for (int k = i; k < j; k++) hist[cmtys[var(metaAdded[k])]] = 0;
+        i = j;
+    }
+    if (metaClauses + added > 0)
+        avgClauseSize = (avgClauseSize * metaClauses + lits) / (metaClauses + added);
 
-    // Search:
-    int curr_restarts = 0;
-    while (status == l_Undef){
-      status = search(0); // the parameter is useless in glucose, kept to allow modifications
+    for (int v = metaVars; v < nVars(); v++) {
+        centrality[v] = opt_center_level == 0 ? cmtycentrality[cmtys[v] + 1] : 0;
+    }
+    metaVars    = nVars();
+    rankDegrees();
+    applyHints();
 
-        if (!withinBudget()) break;
-        curr_restarts++;
+    metaClauses += added;
+    metaAdded.clear();
+    metadataUpdateTime += realTime() - start;
+}
+
+
+/*_________________________________________________________________________________________________
+|
+|  detectCommunities : [void]  ->  [void]
+|  
+|  Description:
+|    Replacement for '-cmty-file'. Builds the weighted variable incidence graph of the problem
+|    clauses and partitions it with Louvain, or with multi-threaded label propagation (under a
+|    wall time budget) on instances too large for Louvain. Fills 'cmtys' and 'cmtystruct'
+|    exactly as reading a '.cmty' file would (ids start at 0).
+|________________________________________________________________________________________________@*/
+void Solver::detectCommunities() {
+    double start    = realTime();
+    int    nthreads = effectiveThreads(opt_graph_threads);
+
+    WGraph   g;
+    vec<int> cmty;
+    buildVarGraph(ca, clauses, nVars(), g, nthreads);
+
+    communityByLPA = opt_cmty_method == 1 || (opt_cmty_method == 2 && nClauses() > 4800000);
+    if (communityByLPA) {
+        // The budget covers graph construction too; once spent, LPA still returns singletons.
+        double budget = opt_cmty_time_lim > 0 ? opt_cmty_time_lim - (realTime() - start) : 0;
+        if (opt_cmty_time_lim > 0 && budget <= 0) budget = 1e-9;
+        communityModularity = labelPropagation(g, cmty, nthreads, budget);
+    } else
+        communityModularity = louvain(g, cmty);
+
+    nbCommunities = 0;
+    for (int i = 0; i < cmty.size(); i++) {
+        cmtys[i] = cmty[i];
+        cmtystruct[cmty[i]]++;
+        if (cmty[i] >= nbCommunities) nbCommunities = cmty[i] + 1;
     }
 
-	//Removed by Lucy
-	/*
-    FILE *fp11, *fp13 ;
-    char *dr1, *dr3 ;
+    communityTime = realTime() - start;
+}
 
-    dr1 = (char*)malloc((strlen((const char*)opt_cnf_file)+4+1)*sizeof(char));
-    strcpy(dr1, (const char*)opt_cnf_file);
-    strcat( dr1, ".dg");
 
-    dr3 = (char*)malloc((strlen((const char*)opt_cnf_file)+4+1)*sizeof(char));
-    strcpy(dr3, (const char*)opt_cnf_file);
-    strcat( dr3, ".decf");      
+/*_________________________________________________________________________________________________
+|
+|  metadataKey : [void]  ->  [uint64_t]
+|  
+|  Description:
+|    Key of the metadata file: content hash of the clauses seen by 'solve_' and of the community
+|    and centrality files, mixed with every setting that changes the communities, bridges or
+|    centralities stored in it.
+|________________________________________________________________________________________________@*/
+static uint64_t hashDouble(uint64_t h, double x) {
+    uint64_t bits;
+    memcpy(&bits, &x, sizeof(bits));
+    return hashMix(h, bits);
+}
 
-    fp11 = fopen(dr1, "w");
-    fp13 = fopen(dr3, "w");
+uint64_t Solver::metadataKey() {
+    uint64_t h = hashClauses(ca, clauses, nVars());
+    h = hashFile(h, cmtyFile);
+    h = hashFile(h, centerFile);
+    h = hashMix(h, opt_cmty_method);
+    h = hashMix(h, opt_center_length);
+    h = hashMix(h, opt_center_level);
+    h = hashDouble(h, opt_vcenter_eps);
+    h = hashDouble(h, opt_vcenter_delta);
+    h = hashDouble(h, opt_vcenter_time_lim);
+    return h;
+}
 
 
-    for (int i = 0 ; i<nVars() ; i++){
-        
-        fprintf(fp11, " %d \t \n", degree[i]  );
-        fprintf(fp13, " %d \t \n", literaldecisions[i]  );
+/*_________________________________________________________________________________________________
+|
+|  loadMetadata : [void]  ->  [bool]
+|  
+|  Description:
+|    Attaches the segment 'metaShm', or else maps '-meta-file', and, if it was computed from the
+|    same clauses and settings, fills 'cmtys', 'cmtystruct', 'cmtycentrality', 'bridges',
+|    'numbridges' and 'cmtybridges' from it instead of reading the text side files or recomputing
+|    them. Returns TRUE if it did. Metadata found in the file is published to 'metaShm' for the
+|    processes that start next.
+|________________________________________________________________________________________________@*/
+bool Solver::loadMetadata() {
+    if (!metaFile && !metaShm) return false;
+    double   start = realTime();
+    uint64_t key   = metadataKey();
+    Metadata meta;
+    if (metaShm)
+        metadataShmStatus = meta.attach(metaShm, key, nVars());
+    if (metaFile && metadataShmStatus != Metadata::Loaded)
+        metadataStatus = meta.load(metaFile, key, nVars());
+    bool loaded = metadataShmStatus == Metadata::Loaded || metadataStatus == Metadata::Loaded;
+    if (loaded) {
+        nbCommunities = meta.nCmtys;
+        if (cmtycentrality.size() < nbCommunities + 1)
+            cmtycentrality.growTo(nbCommunities + 1, 0);
+        for (int c = 0; c <= nbCommunities; c++)
+            cmtycentrality[c] = meta.cmtyCentrality[c];
+        for (int i = 0; i < nVars(); i++) {
+            cmtys[i]      = meta.cmty[i];
+            numbridges[i] = meta.numBridges[i];
+            bridges[i]    = meta.bridge[i];
+            cmtystruct[cmtys[i]]++;
+            if (bridges[i]) cmtybridges[cmtys[i]]++;
+        }
     }
+    if (metaShm && metadataStatus == Metadata::Loaded)
+        metadataPublished = Metadata::publish(metaShm, key, nVars(), nbCommunities, (double*)cmtycentrality,
+                                              (int*)cmtys, (int*)numbridges, (bool*)bridges);
+    metadataTime += realTime() - start;
+    return loaded;
+}
 
-    fclose(fp11);
-    fclose(fp13);
-	*/
 
-    if (!incremental && verbosity >= 1)
-      printf("c =========================================================================================================\n");
+/*_________________________________________________________________________________________________
+|
+|  saveMetadata : [void]  ->  [void]
+|  
+|  Description:
+|    Writes the communities, bridges and community centralities just computed to '-meta-file',
+|    and publishes them to 'metaShm' unless the segment exists already.
+|________________________________________________________________________________________________@*/
+void Solver::saveMetadata() {
+    if (!metaFile && !metaShm) return;
+    double   start = realTime();
+    uint64_t key   = metadataKey();
+    if (cmtycentrality.size() < nbCommunities + 1)
+        cmtycentrality.growTo(nbCommunities + 1, 0);
+    if (metaFile) {
+        if (Metadata::save(metaFile, key, nVars(), nbCommunities, (double*)cmtycentrality,
+                           (int*)cmtys, (int*)numbridges, (bool*)bridges))
+            metadataWritten = true;
+        else
+            fprintf(stderr, "could not write metadata file %s\n", metaFile);
+    }
+    if (metaShm)
+        metadataPublished = Metadata::publish(metaShm, key, nVars(), nbCommunities, (double*)cmtycentrality,
+                                              (int*)cmtys, (int*)numbridges, (bool*)bridges);
+    metadataTime += realTime() - start;
+}
+
 
-    if (certifiedUNSAT){ // Want certified output
-      if (status == l_False)
-	fprintf(certifiedOutput, "0\n");
-      fclose(certifiedOutput);
+/*_________________________________________________________________________________________________
+|
+|  detectBridges : [void]  ->  [void]
+|  
+|  Description:
+|    A variable is a bridge if it shares a clause with a variable of another community. For each
+|    clause, a histogram of the communities of its literals gives, for every literal, the number
+|    of literals of the clause outside its community: that number is added to 'numbridges', so the
+|    counts are those of comparing every pair of literals, in time linear in the clause size.
+|    Clauses are processed in chunks by worker threads; 'bridges' and 'cmtybridges' are derived
+|    from the totals.
+|________________________________________________________________________________________________@*/
+void Solver::detectBridges() {
+    const int chunk    = 4096;
+    double    start    = realTime();
+    int       nthreads = effectiveThreads(opt_graph_threads);
+
+    std::atomic<int>* nb = new std::atomic<int>[nVars()];
+    for (int v = 0; v < nVars(); v++) nb[v].store(0, std::memory_order_relaxed);
+
+    std::atomic<int> next(0);
+    runThreads(nthreads, [&](int t) {
+        vec<int> hist(nbCommunities, 0);
+        for (;;) {
+            int from = next.fetch_add(chunk);
+            if (from >= nClauses()) break;
+            int to = from + chunk < nClauses() ? from + chunk : nClauses();
+
+            for (int i = from; i < to; i++) {
+                const Clause& c = ca[clauses[i]];
+                for (int j = 0; j < c.size(); j++) hist[cmtys[var(c[j])]]++;
+                for (int j = 0; j < c.size(); j++) {
+                    int outside = c.size() - hist[cmtys[var(c[j])]];
+                    if (outside > 0) nb[var(c[j])].fetch_add(outside, std::memory_order_relaxed);
+                }
+                for (int j = 0; j < c.size(); j++) hist[cmtys[var(c[j])]] = 0;
+            }
+        }
+    });
+
+    for (int v = 0; v < nVars(); v++) {
+        int n = nb[v].load(std::memory_order_relaxed);
+        if (n == 0) continue;
+        numbridges[v] += n;
+        if (!bridges[v]) {
+            bridges[v] = true;
+            cmtybridges[cmtys[v]]++;
+        }
     }
+    delete [] nb;
 
+    bridgeTime = realTime() - start;
+}
 
 
-    if (status == l_True){
-        // Extend & copy model:
-        model.growTo(nVars());
-        for (int i = 0; i < nVars(); i++) model[i] = value(i);
-    }else if (status == l_False && conflict.size() == 0)
-        ok = false;
+/*_________________________________________________________________________________________________
+|
+|  rankCentrality : [void]  ->  [void]
+|  
+|  Description:
+|    Sets 'highcenter' and 'centerBump' from the '-center-tiers' specification. Each tier holds
+|    the top 'percent' of the variables by score (ties go to the larger variable index, as with
+|    the stable sort used before). Tiers are nested, so each is selected inside the previous,
+|    wider one, in expected linear time overall. A variable gets the bump multiplier of the
+|    narrowest tier containing it; the others are reset (FALSE, multiplier 1).
+|________________________________________________________________________________________________@*/
+struct ScoreGt {
+    const vec<double>& c;
+    ScoreGt(const vec<double>& c_) : c(c_) { }
+    bool operator () (Var x, Var y) const { return c[x] > c[y] || (c[x] == c[y] && x > y); }
+};
+
+static void parseTiers(const char* spec, vec<double>& percent, vec<double>& mult) {
+    const char* s = spec;
+    if (*s == '\0') return;
+    for (;;) {
+        char*  end;
+        double p = strtod(s, &end);
+        if (end == s || *end != ':' || p < 0 || p > 100) break;
+        s = end + 1;
+        double m = strtod(s, &end);
+        if (end == s || m <= 0) break;
+        // Insertion keeps the tiers from the widest to the narrowest:
+        percent.push(p), mult.push(m);
+        for (int i = percent.size() - 1; i > 0 && percent[i] > percent[i - 1]; i--) {
+            double tp = percent[i]; percent[i] = percent[i - 1]; percent[i - 1] = tp;
+            double tm = mult[i];    mult[i]    = mult[i - 1];    mult[i - 1]    = tm;
+        }
+        if (*end == '\0') return;
+        if (*end != ',') break;
+        s = end + 1;
+    }
+    fprintf(stderr, "invalid tiers '%s' (expected e.g. 10:1.3,30:1.1)\n", spec), exit(1);
+}
 
+static void selectTiers(const vec<double>& score, const char* spec, vec<bool>& in, vec<double>& mult) {
+    vec<double> percent, tmult;
+    parseTiers(spec, percent, tmult);
+
+    int      n = score.size();
+    vec<Var> vs(n);
+    for (int i = 0; i < n; i++) vs[i] = i, in[i] = false, mult[i] = 1;
+
+    int size = n;
+    for (int t = 0; t < percent.size(); t++) {
+        // Rounded down, with some slack for percentages such as 33.33333333 standing for a third:
+        int count = (int)floor(n * percent[t] / 100 + 1e-3 + n * 1e-9);
+        if (count > size) count = size;
+        select((Var*)vs, size, count, ScoreGt(score));
+        for (int i = 0; i < count; i++) {
+            in  [vs[i]] = true;
+            mult[vs[i]] = tmult[t];
+        }
+        size = count;
+    }
+}
 
+void Solver::rankCentrality() {
+    selectTiers(centrality, opt_center_tiers, highcenter, centerBump);
+}
 
-    cancelUntil(0);
 
+/*_________________________________________________________________________________________________
+|
+|  computeDegrees : [void]  ->  [void]
+|  
+|  Description:
+|    Replacement for re-reading '-cnf-file'. One pass over the clauses in memory gives, for
+|    every variable, its degree (number of literals sharing a clause with it, as the old '.dg'
+|    files counted) and its number of occurrences, and the clause size statistics. Variables in
+|    the '-degree-tiers' are high degree; every bump of theirs is scaled by 'degreeBump'.
+|________________________________________________________________________________________________@*/
+void Solver::computeDegrees() {
+    double  start = realTime();
+    int64_t lits  = 0;
 
-    double finalTime = cpuTime();
-    if(status==l_True) {
-        nbSatCalls++; 
-        totalTime4Sat +=(finalTime-curTime);
+    for (int i = 0; i < nVars(); i++) degree[i] = occurrences[i] = 0;
+    minClauseSize = nClauses() > 0 ? INT32_MAX : 0;
+    maxClauseSize = 0;
+    for (int i = 0; i < nClauses(); i++) {
+        const Clause& c = ca[clauses[i]];
+        lits += c.size();
+        if (c.size() < minClauseSize) minClauseSize = c.size();
+        if (c.size() > maxClauseSize) maxClauseSize = c.size();
+        for (int j = 0; j < c.size(); j++) {
+            degree[var(c[j])] += c.size() - 1;
+            occurrences[var(c[j])]++;
+        }
     }
-    if(status==l_False) {
-        nbUnsatCalls++; 
-        totalTime4Unsat +=(finalTime-curTime);
+    avgClauseSize = nClauses() > 0 ? (double)lits / nClauses() : 0;
+    rankDegrees();
+
+    degreeTime = realTime() - start;
+}
+
+void Solver::rankDegrees() {
+    vec<double> score(nVars());
+    for (int i = 0; i < nVars(); i++) score[i] = degree[i];
+    selectTiers(score, opt_degree_tiers, highdegree, degreeBump);
+}
+
+
+/*_________________________________________________________________________________________________
+|
+|  computeBumpMult : [void]  ->  [void]
+|  
+|  Description:
+|    Folds the bump policy, the centrality tiers and the degree tiers into 'bumpMult', so that
+|    conflict analysis does a single load per bumped variable:
+|      * BumpBridgeCenter: high centers that are bridges get their 'centerBump'.
+|      * BumpCenterEarly:  high centers get their 'centerBump' during the first 'centerDecisions'
+|                          decisions; 'bumpMultUntil' makes 'analyze' recompute the array then.
+|      * BumpBridgeScaled: bridges get 1 + centrality/10.
+|    A positive priority hint ('setPriorityHints') replaces the multiplier of the policy. Every
+|    multiplier is then scaled by the 'degreeBump' of the variable.
+|________________________________________________________________________________________________@*/
+void Solver::computeBumpMult() {
+    bool early = bumpPolicy == BumpCenterEarly && decisions < (uint64_t)centerDecisions;
+    for (int i = 0; i < nVars(); i++) {
+        double m = 1;
+        switch (bumpPolicy) {
+        case BumpBridgeCenter: if (highcenter[i] && bridges[i]) m = centerBump[i]; break;
+        case BumpCenterEarly:  if (highcenter[i] && early)      m = centerBump[i]; break;
+        case BumpBridgeScaled: if (bridges[i])                  m = 1 + centrality[i] / 10.0; break;
+        }
+        if (i < hintPriority.size() && hintPriority[i] > 0) m = hintPriority[i];
+        bumpMult[i] = m * degreeBump[i];
     }
-    
+    bumpMultUntil = early ? (uint64_t)centerDecisions : UINT64_MAX;
+}
 
-    return status;
 
+/*_________________________________________________________________________________________________
+|
+|  computeCentrality : [void]  ->  [void]
+|  
+|  Description:
+|    Replacement for '-center-file'. Builds the community graph (edge weight = number of clauses
+|    joining two communities) from 'cmtys' and computes its betweenness centrality in parallel,
+|    normalised to [0,1]. Fills 'cmtycentrality' with the centrality file numbering (community
+|    'c' of 'cmtys' is entry 'c+1').
+|________________________________________________________________________________________________@*/
+void Solver::computeCentrality() {
+    double start = realTime();
+
+    WGraph      g;
+    vec<double> bc;
+    buildCommunityGraph(ca, clauses, cmtys, nbCommunities, g);
+    betweenness(g, bc, opt_center_length == 0 ? InverseLength : InverseSquareLength, true, opt_graph_threads);
+
+    if (cmtycentrality.size() < nbCommunities + 1)
+        cmtycentrality.growTo(nbCommunities + 1, 0);
+    for (int c = 0; c < nbCommunities; c++)
+        cmtycentrality[c + 1] = bc[c];
+
+    centralityTime = realTime() - start;
 }
 
 
+/*_________________________________________________________________________________________________
+|
+|  computeVarCentrality : [void]  ->  [void]
+|  
+|  Description:
+|    Per-variable alternative to 'computeCentrality' ('-center-level=1'). Betweenness on the
+|    variable incidence graph is approximated by shortest path sampling, within the error bound,
+|    confidence and wall time budget given by the 'vcenter-*' options, and normalised to [0,1].
+|    Fills 'centrality' directly, so that 'highcenter' ranks variables within a community too.
+|________________________________________________________________________________________________@*/
+void Solver::computeVarCentrality() {
+    double start = realTime();
+
+    WGraph      g;
+    vec<double> bc;
+    buildVarGraph(ca, clauses, nVars(), g, effectiveThreads(opt_graph_threads));
+    double budget = opt_vcenter_time_lim > 0 ? opt_vcenter_time_lim - (realTime() - start) : 0;
+    if (opt_vcenter_time_lim > 0 && budget <= 0) budget = 1e-9;
+    centralitySamples = approxBetweenness(g, bc, opt_center_length == 0 ? InverseLength : InverseSquareLength,
+                                          opt_vcenter_eps, opt_vcenter_delta, true, opt_graph_threads, budget);
+
+    for (int i = 0; i < nVars(); i++)
+        centrality[i] = bc[i];
 
+    centralityTime = realTime() - start;
+}
 
 
 //=================================================================================================
@@ -2049,6 +2646,84 @@ void Solver::toDimacs(FILE* f, const vec<Lit>& assumps) {
 }
 
 
+//=================================================================================================
+// LRAT proof (-certified-lrat):
+//
+// Every lemma comes with the ids of the clauses that derive it by unit propagation from its
+// negation, in the order they become unit. The ids of the clauses are kept by 'ca' (and follow them
+// through 'relocAll'); a fact of the root level has the id of the unit clause written for it when
+// it was assigned, so that the clauses of the proof never depend on the trail.
+
+
+uint64_t Solver::lratInput() {
+    uint64_t id = certifiedOutput->input();
+    if (id == 0)
+        fprintf(stderr, "ERROR! More clauses than in the DIMACS header: no ids left for the LRAT proof\n"), exit(3);
+    return id;
+}
+
+
+void Solver::lratRootUnit(Lit p, CRef from) {
+    const Clause& c = ca[from];
+    lratHints.clear();
+    for (int i = 0; i < c.size(); i++)
+        if (c[i] != p) lratHints.push(unitIds[var(c[i])]);
+    lratHints.push(ca.id(from));
+    lratUnit.clear();
+    lratUnit.push(p);
+    unitIds[var(p)] = certifiedOutput->lemma(lratUnit, lratHints);
+}
+
+
+void Solver::lratEmpty(CRef confl) {
+    const Clause& c = ca[confl];
+    lratHints.clear();
+    for (int i = 0; i < c.size(); i++)
+        lratHints.push(unitIds[var(c[i])]);
+    lratHints.push(ca.id(confl));
+    lratUnit.clear();
+    certifiedOutput->lemma(lratUnit, lratHints);
+}
+
+
+/*_________________________________________________________________________________________________
+|
+|  lratAnalyzeHints : (out_learnt : const vec<Lit>&)  ->  [void]
+|
+|  Description:
+|    Called at the end of 'analyze', while 'seen' still marks the literals it visited. Completes
+|    'lratSteps' (the conflict and the reasons resolved, then the binary clauses of
+|    'minimisationWithBinaryResolution') with the reasons of the literals that the minimisation
+|    removed or went through in 'litRedundant', and fills 'lratHints' with: the unit clauses of the
+|    root facts of all these clauses, the binary clauses, then the reasons in the order of the trail
+|    and the conflict. Under the negation of 'out_learnt', each one is then unit in turn.
+|________________________________________________________________________________________________@*/
+void Solver::lratAnalyzeHints(const vec<Lit>& out_learnt) {
+    for (int i = 0; i < out_learnt.size(); i++)
+        seen[var(out_learnt[i])] = 0;
+    for (int i = 0; i < analyze_toclear.size(); i++) {
+        Var x = var(analyze_toclear[i]);
+        if (seen[x] && reason(x) != CRef_Undef)
+            lratSteps.push((uint64_t)(trailIndex[x] + 1) << 32 | reason(x)); }
+    sort(lratSteps);
+
+    lratHints.clear();
+    MYFLAG++;
+    for (int i = 0; i < lratSteps.size(); i++) {
+        const Clause& c = ca[(CRef)lratSteps[i]];
+        for (int j = 0; j < c.size(); j++)
+            if (level(var(c[j])) == 0 && permDiff[var(c[j])] != MYFLAG) {
+                permDiff[var(c[j])] = MYFLAG;
+                lratHints.push(unitIds[var(c[j])]); }
+    }
+    for (int i = 0; i < lratSteps.size(); i++) {
+        uint64_t at = lratSteps[i] >> 32;      // A literal both resolved and visited by 'litRedundant' counts once.
+        if (at == 0 || i == 0 || at != lratSteps[i - 1] >> 32)
+            lratHints.push(ca.id((CRef)lratSteps[i]));
+    }
+}
+
+
 //=================================================================================================
 // Garbage Collection methods:
 
@@ -2141,3 +2816,26 @@ bool Solver::parallelJobIsFinished() {
 
 void Solver::parallelImportClauseDuringConflictAnalysis(Clause &c,CRef confl) {
 }
+
+// Adds a learnt clause of another solver, simplified by the root facts. Returns FALSE if it is empty.
+bool Solver::importLearnt(vec<Lit>& ps, int lbd) {
+    int i, j;
+    for (i = j = 0; i < ps.size(); i++) {
+        if (value(ps[i]) == l_True) return true;
+        if (value(ps[i]) == l_Undef) ps[j++] = ps[i];
+    }
+    ps.shrink(i - j);
+
+    if (ps.size() == 0) return false;
+    if (ps.size() == 1) {
+        uncheckedEnqueue(ps[0]);
+        return true; }
+
+    CRef cr = ca.alloc(ps, true);
+    ca[cr].setLBD(lbd);
+    ca[cr].setOneWatched(false);
+    ca[cr].setSizeWithoutSelectors(ps.size());
+    learnts.push(cr);
+    attachClause(cr);
+    return true;
+}
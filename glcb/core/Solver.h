@@ -50,6 +50,8 @@ OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWA
 #ifndef Glucose_Solver_h
 #define Glucose_Solver_h
 
+#include <atomic>
+
 #include "mtl/Heap.h"
 #include "mtl/Alg.h"
 #include "utils/Options.h"
@@ -61,12 +63,21 @@ OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWA
 
 namespace Glucose {
 
+class AsyncSolve;
+class CheckpointWriter;
+class CheckpointReader;
+class Proof;
+
 //=================================================================================================
 // Solver -- the main class:
 
 class Solver : public Clone {
 
     friend class SolverConfiguration;
+    friend class Portfolio;
+    friend class CubeAndConquer;
+    friend class AsyncSolve;
+    friend class ResultCache;
 
 public:
 
@@ -105,6 +116,20 @@ public:
     bool    solve        (Lit p, Lit q);            // Search for a model that respects two assumptions.
     bool    solve        (Lit p, Lit q, Lit r);     // Search for a model that respects three assumptions.
     bool    okay         () const;                  // FALSE means solver is in a conflicting state
+    void    setCommunityHints (const int*    cmty,   int n);   // Community of the variables 0..n-1 (ids below 'nVars()').
+    void    setCentralityHints(const double* center, int n);   // Centrality of the variables 0..n-1.
+    void    setBridgeHints    (const bool*   bridge, int n);   // Bridge flags of the variables 0..n-1.
+    void    setPriorityHints  (const double* weight, int n);   // Bump multiplier of the variables 0..n-1 (> 0), in place of the bump policy's.
+    void    initMetadata ();                        // Compute the graph metadata (communities, bridges, centralities) once; later calls extend it to added variables and clauses.
+
+    // Warm start (core/WarmStart.h): learnt clauses, activities and phases kept across runs.
+    uint64_t formulaKey    ();                                            // Hash of the problem clauses and root facts, to be taken right after parsing.
+    bool     saveWarmStart (const char* path, uint64_t key, int maxLbd, int maxClauses); // Write them for the formula of 'key'; FALSE on I/O error.
+    int      loadWarmStart (const char* path, uint64_t key);              // Add them if the file is for 'key': clauses added, or -1.
+
+    // Checkpoints (core/Checkpoint.h): the complete search state, to resume a preempted search.
+    bool     saveCheckpoint(const char* path, uint64_t key);              // Write it for the formula of 'key' (at decision level 0); FALSE on I/O error.
+    bool     loadCheckpoint(const char* path, uint64_t key);              // Replace the state by that of the file if it is for 'key'; FALSE (unchanged) otherwise.
 
        // Convenience versions of 'toDimacs()':
     void    toDimacs     (FILE* f, const vec<Lit>& assumps);            // Write CNF to file in DIMACS-format.
@@ -142,6 +167,7 @@ public:
     // Incremental mode
     void setIncrementalMode();
     void initNbInitialVars(int nb);
+    void initNbInitialClauses(int nb);  // Clauses of the DIMACS header, for the ids of an LRAT proof.
     void printIncrementalStats();
     bool isIncremental();
     // Resource contraints:
@@ -151,6 +177,7 @@ public:
     void    budgetOff();
     void    interrupt();          // Trigger a (potentially asynchronous) interruption of the solver.
     void    clearInterrupt();     // Clear interrupt indicator flag.
+    bool    interrupted() const;  // Was an interruption triggered (and not cleared)?
 
     // Memory managment:
     //
@@ -200,9 +227,32 @@ public:
     // Constant for Memory managment
     double    garbage_frac;       // The fraction of wasted memory allowed before a garbage collection is triggered.
 
+    // Preferential bumping
+    enum BumpPolicy { BumpBridgeCenter = 0, BumpCenterEarly = 1, BumpBridgeScaled = 2, BumpNone = 3 };
+    int       bumpPolicy;         // How conflict analysis bumps variables (a 'BumpPolicy').
+    int       centerDecisions;    // Decisions during which high centers are preferred ('BumpCenterEarly').
+
+    // Parallel search
+    int       searchThreads;      // Search threads (1=sequential, 0=one per core): a portfolio (core/Portfolio.h) or cube solvers.
+    int       cubeDepth;          // Depth of the cube tree, 0 for no cube-and-conquer (core/Cubes.h).
+    int       cubeCands;          // Split candidates considered at each node of the cube tree.
+
+    // Metadata side files (NULL if none), see 'initMetadata'
+    const char* cmtyFile;         // Communities.
+    const char* centerFile;       // Community centralities.
+    const char* metaFile;         // Binary metadata cache, see core/Metadata.h.
+    const char* metaShm;          // Shared-memory segment ("/..") of the same, attached or published.
+
+    // Checkpoints written between restarts of the sequential search (see 'saveCheckpoint')
+    const char* checkpointFile;   // NULL if none.
+    uint64_t    checkpointKey;    // 'formulaKey' of the formula, stored in the checkpoints.
+    int64_t     checkpointEvery;  // Conflicts between two checkpoints, 0 for none but the requested ones.
+    bool        checkpointRequested; // Write one at the next restart (may be set by a signal handler).
+
     // Certified UNSAT ( Thanks to Marijn Heule)
-    FILE*               certifiedOutput;
+    Proof*              certifiedOutput;  // Where the proof steps go (core/Proof.h); closed by the caller.
     bool                certifiedUNSAT;
+    bool                certifiedLRAT;    // 'certifiedOutput' is LRAT (set before the first variable; no simplification).
 
     // Panic mode. 
     // Save memory
@@ -221,6 +271,7 @@ public:
     virtual void parallelExportClauseDuringSearch(Clause &c);
     virtual bool parallelJobIsFinished();
     virtual bool panicModeIsEnabled();
+    bool         importLearnt(vec<Lit>& ps, int lbd); // Add a clause learnt elsewhere at level 0 (FALSE if it is empty under the root facts)
     
     
 
@@ -236,6 +287,24 @@ public:
 
    bridge_decisions, highbridge_decisions, highdegree_decisions, highcenter_decisions, mutual_decisions,  mutualbrgcenter_decisions, mutualhdhc_decisions ;
 
+    int      nbCommunities;        // Number of communities (read from -cmty-file or detected)
+    double   communityModularity;  // Modularity of the detected partition
+    double   communityTime;        // Wall time spent building the graph and detecting communities
+    bool     communityByLPA;       // Communities were detected by label propagation rather than Louvain
+    double   centralityTime;       // Wall time spent building the graph and computing betweenness
+    int      centralitySamples;    // Shortest paths sampled for variable-level betweenness
+    double   bridgeTime;           // Wall time spent finding bridge variables
+    int      metadataStatus;       // Outcome of loading -meta-file (a Metadata::Status)
+    bool     metadataWritten;      // -meta-file was (re)written
+    int      metadataShmStatus;    // Outcome of attaching 'metaShm' (a Metadata::Status)
+    bool     metadataPublished;    // 'metaShm' was created by this solver
+    double   metadataTime;         // Wall time spent loading and writing -meta-file
+    int      minClauseSize;        // Clause size statistics of the problem clauses
+    int      maxClauseSize;
+    double   avgClauseSize;
+    double   degreeTime;           // Wall time spent computing degrees and occurrences
+    double   metadataUpdateTime;   // Wall time spent extending the metadata after the first solve
+
 protected:
 
     long curRestart;
@@ -332,6 +401,13 @@ protected:
     vec<Lit>            add_tmp;
     unsigned int  MYFLAG;
 
+    // LRAT proof: the clause ids are kept by 'ca', the root facts have the ids of their unit clauses.
+    vec<int>            trailIndex;       // Position of each assigned variable on the trail.
+    vec<uint64_t>       unitIds;          // Id of the unit clause of each root fact.
+    vec<uint64_t>       lratSteps;        // Clauses of the current analysis, as (trail index + 1) << 32 | CRef.
+    vec<uint64_t>       lratHints;        // Hints of the next lemma.
+    vec<Lit>            lratUnit;
+
     // Initial reduceDB strategy
     double              max_learnts;
     double              learntsize_adjust_confl;
@@ -341,7 +417,8 @@ protected:
     //
     int64_t             conflict_budget;    // -1 means no budget.
     int64_t             propagation_budget; // -1 means no budget.
-    bool                asynch_interrupt;
+    std::atomic<bool>   asynch_interrupt;   // Set from other threads and signal handlers (lock-free, relaxed).
+    AsyncSolve*         async;              // The handle of the running 'solveAsync', if any (core/Async.h).
 
     //Sima
     vec<bool> bridges;
@@ -355,7 +432,12 @@ protected:
     vec<int> sortednumbridges  ;
     vec<bool> highdegree;
     vec<bool> highcenter;
-    vec<int> degree  ;
+    vec<double> centerBump ; //centerBump[variable] = bump multiplier of its centrality tier (1 if in none)
+    vec<int> degree  ;        //degree[variable] = number of literals sharing a clause with it
+    vec<int> occurrences  ;   //occurrences[variable] = number of clauses containing it
+    vec<double> degreeBump ;  //degreeBump[variable] = bump multiplier of its degree tier (1 if in none)
+    vec<double> bumpMult ;    //bumpMult[variable] = multiplier of its bumps in conflict analysis, see 'computeBumpMult'
+    uint64_t    bumpMultUntil; // 'bumpMult' is recomputed when 'decisions' reaches this
     vec<int> degreearrangedliterals  ;
     vec<int> bridgearrangedliterals  ;
     vec<int> sortedDegree  ;
@@ -370,6 +452,15 @@ protected:
 	vec<double> centrality ;   //centrality[vertex]=betweenness centrality score
 	vec<double> sortedcentrality;   //sortedcentrality[vertex rank]=betweenness centrality score
     vec<double> cmtycentrality	;   //cmtycentrality[cmty]=betweenness centrality score
+    bool     metadataReady;   // 'initMetadata' has run
+    int      metaVars;        // Variables covered by the metadata
+    int      metaClauses;     // Problem clauses counted in the clause size statistics
+    vec<Lit> metaAdded;       // Problem clauses added since, each followed by lit_Undef
+    vec<int>    hintCmty;        // Graph hints given in memory, see 'setCommunityHints' etc.
+    vec<double> hintCentrality;
+    vec<bool>   hintBridge;
+    vec<double> hintPriority;
+    bool        metadataRestored; // The metadata came from a checkpoint: 'initMetadata' only derives the tiers.
 	//vec<int> cmtyhighcenter	; //cmtyhighcenter[cmty] = # high centrality variables    
 	//double cutoff ; //preferentially bumped variables must have centrality score (normalized from 0 to 1) at or above cutoff
 
@@ -394,10 +485,25 @@ protected:
     CRef     propagateUnaryWatches(Lit p);                                                  // Perform propagation on unary watches of p, can find only conflicts
     void     cancelUntil      (int level);                                             // Backtrack until a certain level.
     void     analyze          (CRef confl, vec<Lit>& out_learnt, vec<Lit> & selectors, int& out_btlevel,unsigned int &nblevels,unsigned int &szWithoutSelectors);    // (bt = backtrack)
+    template<int Policy>
+    void     analyze          (CRef confl, vec<Lit>& out_learnt, vec<Lit> & selectors, int& out_btlevel,unsigned int &nblevels,unsigned int &szWithoutSelectors);    // 'analyze' for one 'BumpPolicy'.
     void     analyzeFinal     (Lit p, vec<Lit>& out_conflict);                         // COULD THIS BE IMPLEMENTED BY THE ORDINARIY "analyze" BY SOME REASONABLE GENERALIZATION?
     bool     litRedundant     (Lit p, uint32_t abstract_levels);                       // (helper method for 'analyze()')
     lbool    search           (int nof_conflicts);                                     // Search for a given number of conflicts.
     virtual lbool    solve_           (bool do_simp = true, bool turn_off_simp = false);                                                      // Main solve method (assumptions given in 'assumptions').
+    void     detectCommunities();                                                      // Fill 'cmtys'/'cmtystruct' from the variable incidence graph (Louvain or label propagation).
+    uint64_t metadataKey();                                                            // Hash of the clauses and of the settings the metadata depends on.
+    bool     loadMetadata();                                                           // Fill communities, bridges and centralities from -meta-file if it matches.
+    void     saveMetadata();                                                           // Write them to -meta-file.
+    void     detectBridges();                                                          // Fill 'bridges'/'numbridges'/'cmtybridges' from 'cmtys'.
+    void     updateMetadata();                                                         // Extend the metadata to the variables and clauses added since 'initMetadata'.
+    void     computeDegrees();                                                         // Fill 'degree'/'occurrences', clause size statistics and 'highdegree'.
+    void     rankDegrees();                                                            // Fill 'highdegree'/'degreeBump' from the degree tiers.
+    void     rankCentrality();                                                         // Fill 'highcenter'/'centerBump' from the centrality tiers.
+    void     computeBumpMult();                                                        // Fill 'bumpMult' from the bump policy and the tiers.
+    void     applyHints();                                                             // Apply the bridge, centrality and priority hints to the existing metadata.
+    void     computeCentrality();                                                      // Fill 'cmtycentrality' with the betweenness of the community graph.
+    void     computeVarCentrality();                                                   // Fill 'centrality' with the sampled betweenness of the variable graph.
     virtual void     reduceDB         ();                                                      // Reduce the set of learnt clauses.
     void     removeSatisfied  (vec<CRef>& cs);                                         // Shrink 'cs' to contain only non-satisfied clauses.
     void     rebuildOrderHeap ();
@@ -424,8 +530,22 @@ protected:
     unsigned int computeLBD(const Clause &c);
     void minimisationWithBinaryResolution(vec<Lit> &out_learnt);
 
+    // LRAT proof:
+    //
+    uint64_t lratInput        ();                      // Id of the next input clause.
+    void     lratRootUnit     (Lit p, CRef from);      // Write the unit 'p' implied at the root by 'from'.
+    void     lratAnalyzeHints (const vec<Lit>& out_learnt); // Fill 'lratHints' for the clause learnt by 'analyze'.
+    void     lratEmpty        (CRef confl);            // Write the empty clause from a conflict at the root.
+
     virtual void     relocAll         (ClauseAllocator& to);
 
+    // Checkpoints:
+    //
+    template<class Stream>
+    void     stateScalars     (Stream& s);             // The counters, schedules and increments, for 'writeState' and 'readState'.
+    virtual void     writeState       (CheckpointWriter& out);  // Write the search state (at decision level 0).
+    virtual void     readState        (CheckpointReader& in);   // Replace the search state by the one read.
+
     // Misc:
     //
     int      decisionLevel    ()      const; // Gives the current decisionlevel.
@@ -531,11 +651,12 @@ inline void     Solver::setDecisionVar(Var v, bool b)
 }
 inline void     Solver::setConfBudget(int64_t x){ conflict_budget    = conflicts    + x; }
 inline void     Solver::setPropBudget(int64_t x){ propagation_budget = propagations + x; }
-inline void     Solver::interrupt(){ asynch_interrupt = true; }
-inline void     Solver::clearInterrupt(){ asynch_interrupt = false; }
+inline void     Solver::interrupt(){ asynch_interrupt.store(true, std::memory_order_relaxed); }
+inline void     Solver::clearInterrupt(){ asynch_interrupt.store(false, std::memory_order_relaxed); }
+inline bool     Solver::interrupted() const { return asynch_interrupt.load(std::memory_order_relaxed); }
 inline void     Solver::budgetOff(){ conflict_budget = propagation_budget = -1; }
 inline bool     Solver::withinBudget() const {
-    return !asynch_interrupt &&
+    return !interrupted() &&
            (conflict_budget    < 0 || conflicts < (uint64_t)conflict_budget) &&
            (propagation_budget < 0 || propagations < (uint64_t)propagation_budget); }
 
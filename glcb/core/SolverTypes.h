@@ -272,6 +272,7 @@ class ClauseAllocator : public RegionAllocator<uint32_t>
 {
     static int clauseWord32Size(int size, int extra_size){
         return (sizeof(Clause) + (sizeof(Lit) * (size + extra_size))) / sizeof(uint32_t); }
+    vec<uint64_t> ids;      // Proof ids of the clauses (LRAT), indexed by reference; empty without.
  public:
     bool extra_clause_field;
 
@@ -280,8 +281,12 @@ class ClauseAllocator : public RegionAllocator<uint32_t>
 
     void moveTo(ClauseAllocator& to){
         to.extra_clause_field = extra_clause_field;
+        ids.moveTo(to.ids);
         RegionAllocator<uint32_t>::moveTo(to); }
 
+    uint64_t id   (CRef cr) const         { return cr < (CRef)ids.size() ? ids[cr] : 0; }
+    void     setId(CRef cr, uint64_t i)   { if ((CRef)ids.size() <= cr) ids.growTo(cr + 1, 0); ids[cr] = i; }
+
     template<class Lits>
     CRef alloc(const Lits& ps, bool learnt = false, bool imported = false)
     {
@@ -315,8 +320,10 @@ class ClauseAllocator : public RegionAllocator<uint32_t>
         
         if (c.reloced()) { cr = c.relocation(); return; }
         
+        CRef from = cr;
         cr = to.alloc(c, c.learnt(), c.wasImported());
         c.relocate(cr);
+        if (ids.size() > 0) to.setId(cr, id(from));
         
         // Copy extra data-fields: 
         // (This could be cleaned-up. Generalize Clause-constructor to be applicable here instead?)
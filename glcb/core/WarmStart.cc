@@ -0,0 +1,152 @@
+/***********************************************************************************[WarmStart.cc]
+ Same licence as the rest of Glucose (see LICENCE).
+ **************************************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "mtl/Sort.h"
+#include "core/Solver.h"
+#include "core/Metadata.h"
+#include "core/WarmStart.h"
+
+using namespace Glucose;
+
+static const char warmMagic[8] = { 'G', 'L', 'C', 'B', 'W', 'A', 'R', 'M' };
+
+struct GlueLt {
+    const ClauseAllocator& ca;
+    GlueLt(const ClauseAllocator& ca_) : ca(ca_) { }
+    bool operator()(CRef x, CRef y) const {
+        return ca[x].lbd() < ca[y].lbd() || (ca[x].lbd() == ca[y].lbd() && ca[x].size() < ca[y].size()); }
+};
+
+uint64_t Solver::formulaKey() {
+    uint64_t h = hashClauses(ca, clauses, nVars());
+    for (int i = 0; i < trail.size(); i++)
+        h = hashMix(h, toInt(trail[i]) + 1);
+    return h;
+}
+
+
+/*_________________________________________________________________________________________________
+|
+|  saveWarmStart : (path : const char*) (key : uint64_t) (maxLbd maxClauses : int)  ->  [bool]
+|  
+|  Description:
+|    Writes the root facts, then at most 'maxClauses' learnt clauses of LBD at most 'maxLbd' (glue
+|    clauses first), the activities and the phases to 'path', for the formula of 'key'. Called
+|    at decision level 0, after a search that was interrupted or ran out of time.
+|________________________________________________________________________________________________@*/
+bool Solver::saveWarmStart(const char* path, uint64_t key, int maxLbd, int maxClauses) {
+    vec<CRef> keep;
+    for (int i = 0; i < learnts.size(); i++)
+        if ((int)ca[learnts[i]].lbd() <= maxLbd) keep.push(learnts[i]);
+    sort(keep, GlueLt(ca));
+    if (keep.size() > maxClauses) keep.shrink(keep.size() - maxClauses);
+
+    WarmStartHeader h;
+    memset(&h, 0, sizeof(h));
+    memcpy(h.magic, warmMagic, sizeof(warmMagic));
+    h.version  = WarmStartHeader::Version;
+    h.nVars    = nVars();
+    h.key      = key;
+    h.nClauses = trail.size() + keep.size();
+    h.varInc   = var_inc;
+
+    vec<int32_t> words;
+    for (int i = 0; i < trail.size(); i++) {
+        words.push(1);
+        words.push(1);
+        words.push(toInt(trail[i])); }
+    for (int i = 0; i < keep.size(); i++) {
+        const Clause& c = ca[keep[i]];
+        words.push(c.lbd());
+        words.push(c.size());
+        for (int j = 0; j < c.size(); j++) words.push(toInt(c[j])); }
+    vec<uint8_t> pol(nVars());
+    for (int v = 0; v < nVars(); v++) pol[v] = polarity[v];
+
+    char* tmp = new char[strlen(path) + 5];
+    sprintf(tmp, "%s.tmp", path);
+    FILE* f       = fopen(tmp, "wb");
+    bool  written = f != NULL;
+    if (written) {
+        written = fwrite(&h, sizeof(h), 1, f) == 1
+          && fwrite((double*)activity, sizeof(double), nVars(), f) == (size_t)nVars()
+          && fwrite((uint8_t*)pol, 1, nVars(), f) == (size_t)nVars()
+          && fwrite((int32_t*)words, sizeof(int32_t), words.size(), f) == (size_t)words.size();
+        written = fclose(f) == 0 && written;
+        written = written && rename(tmp, path) == 0;
+        if (!written) ::remove(tmp);
+    }
+    delete [] tmp;
+    return written;
+}
+
+
+/*_________________________________________________________________________________________________
+|
+|  loadWarmStart : (path : const char*) (key : uint64_t)  ->  [int]
+|  
+|  Description:
+|    Reads a file of 'saveWarmStart' written for the formula of 'key' and adds its clauses as
+|    learnt clauses (root facts included), then takes its activities and phases. Clauses over
+|    variables that are no longer decision variables (eliminated by the simplifier of this run)
+|    are skipped. Called at decision level 0 before solving; returns the number of clauses added,
+|    or -1 if the file is missing, damaged or for another formula. May set 'ok' to FALSE if the
+|    clauses refute the formula.
+|________________________________________________________________________________________________@*/
+int Solver::loadWarmStart(const char* path, uint64_t key) {
+    FILE* f = fopen(path, "rb");
+    if (f == NULL) return -1;
+
+    WarmStartHeader h;
+    bool valid = fread(&h, sizeof(h), 1, f) == 1
+           && memcmp(h.magic, warmMagic, sizeof(warmMagic)) == 0 && h.version == WarmStartHeader::Version
+           && h.key == key && h.nVars == (uint32_t)nVars();
+    vec<double>  act(valid ? nVars() : 0);
+    vec<uint8_t> pol(valid ? nVars() : 0);
+    valid = valid && fread((double*)act, sizeof(double), nVars(), f) == (size_t)nVars()
+            && fread((uint8_t*)pol, 1, nVars(), f) == (size_t)nVars();
+
+    // Read all clauses before adding any, so that a truncated file changes nothing:
+    vec<int32_t> words;
+    int32_t      buf[2];
+    for (uint32_t i = 0; valid && i < h.nClauses; i++) {
+        valid = fread(buf, sizeof(int32_t), 2, f) == 2 && buf[1] > 0 && buf[1] <= nVars();
+        int first = words.size();
+        words.push(buf[0]);
+        words.push(buf[1]);
+        words.growTo(first + 2 + (valid ? buf[1] : 0));
+        valid = valid && fread(&words[first + 2], sizeof(int32_t), buf[1], f) == (size_t)buf[1];
+        for (int j = first + 2; valid && j < words.size(); j++)
+            valid = words[j] >= 0 && words[j] < 2 * nVars();
+    }
+    fclose(f);
+    if (!valid) return -1;
+
+    for (int v = 0; v < nVars(); v++) {
+        activity[v] = act[v];
+        polarity[v] = pol[v]; }
+    var_inc = h.varInc;
+    rebuildOrderHeap();
+
+    int      added = 0;
+    vec<Lit> ps;
+    for (int i = 0; ok && i < words.size(); ) {
+        int  lbd = words[i], size = words[i + 1];
+        bool usable = true;
+        ps.clear();
+        for (int j = 0; j < size; j++) {
+            Lit p = toLit(words[i + 2 + j]);
+            usable = usable && decision[var(p)];
+            ps.push(p); }
+        i += 2 + size;
+        if (!usable) continue;
+        added++;
+        if (!importLearnt(ps, lbd)) ok = false;
+    }
+    if (ok && propagate() != CRef_Undef) ok = false;
+    return added;
+}
@@ -0,0 +1,41 @@
+/************************************************************************************[WarmStart.h]
+ Binary container of the search state worth keeping across runs of one formula: the learnt
+ clauses of low LBD, the root facts, the variable activities and the saved phases.
+
+ Layout (native endianness, version 'WarmStartHeader::Version'):
+
+     header     WarmStartHeader                       (64 bytes)
+     double     activity[nVars]
+     uint8      polarity[nVars]                       (as 'Solver::polarity')
+     clauses    nClauses times: int32 lbd, int32 size, int32 lits[size] (as 'toInt(lit)')
+
+ Clauses come by increasing LBD, then size; the root facts come first, as clauses of size 1.
+ The file is keyed by 'Solver::formulaKey' of the parsed formula, so a file of another formula,
+ or of the same formula with its variables renumbered, is ignored.
+
+ Same licence as the rest of Glucose (see LICENCE).
+ **************************************************************************************************/
+
+#ifndef Glucose_WarmStart_h
+#define Glucose_WarmStart_h
+
+#include <stdint.h>
+
+namespace Glucose {
+
+struct WarmStartHeader {
+    enum { Version = 1 };
+
+    char     magic[8];     // "GLCBWARM"
+    uint32_t version;
+    uint32_t nVars;
+    uint64_t key;
+    uint32_t nClauses;
+    uint32_t reserved;
+    double   varInc;       // 'var_inc' when saved, the scale of the activities.
+    char     pad[24];
+};
+
+}
+
+#endif
@@ -82,6 +82,35 @@ template <class T> static inline void sort(T* array, int size) {
     sort(array, size, LessThan_default<T>()); }
 
 
+// Partial ordering: moves the 'k' smallest elements of 'array' (in no particular order) to its
+// first 'k' positions. Quickselect on the same partitioning as 'sort', in expected linear time.
+template <class T, class LessThan>
+void select(T* array, int size, int k, LessThan lt)
+{
+    while (size > 15){
+        T           pivot = array[size / 2];
+        T           tmp;
+        int         i = -1;
+        int         j = size;
+
+        for(;;){
+            do i++; while(lt(array[i], pivot));
+            do j--; while(lt(pivot, array[j]));
+
+            if (i >= j) break;
+
+            tmp = array[i]; array[i] = array[j]; array[j] = tmp;
+        }
+
+        if (k < i)
+            size = i;
+        else{
+            array += i; size -= i; k -= i; }
+    }
+    selectionSort(array, size, lt);
+}
+
+
 //=================================================================================================
 // For 'vec's:
 
@@ -90,6 +119,8 @@ template <class T, class LessThan> void sort(vec<T>& v, LessThan lt) {
     sort((T*)v, v.size(), lt); }
 template <class T> void sort(vec<T>& v) {
     sort(v, LessThan_default<T>()); }
+template <class T, class LessThan> void select(vec<T>& v, int k, LessThan lt) {
+    select((T*)v, v.size(), k, lt); }
 
 
 //=================================================================================================
@@ -5,13 +5,21 @@
 ##        "make d"  for a debug version (no optimizations).
 ##        "make"    for the standard version (optimized, but with debug information and assertions active)
 
+##    A directory may build the sources of another one (SRCDIR, e.g. $(MROOT)/simp), with its own
+##    flags: OBJDIR then keeps its objects apart from those of the source tree.
+
 PWD        = $(shell pwd)
 EXEC      ?= $(notdir $(PWD))
+SRCDIR    ?= $(PWD)
 
-CSRCS      = $(wildcard $(PWD)/*.cc) 
+CSRCS      = $(wildcard $(SRCDIR)/*.cc) 
 DSRCS      = $(foreach dir, $(DEPDIR), $(filter-out $(MROOT)/$(dir)/Main.cc, $(wildcard $(MROOT)/$(dir)/*.cc)))
-CHDRS      = $(wildcard $(PWD)/*.h)
+CHDRS      = $(wildcard $(SRCDIR)/*.h)
+ifeq ($(OBJDIR),)
 COBJS      = $(CSRCS:.cc=.o) $(DSRCS:.cc=.o)
+else
+COBJS      = $(patsubst $(MROOT)/%.cc, $(OBJDIR)/%.o, $(CSRCS) $(DSRCS))
+endif
 
 PCOBJS     = $(addsuffix p,  $(COBJS))
 DCOBJS     = $(addsuffix d,  $(COBJS))
@@ -26,6 +34,9 @@ COPTIMIZE ?= -O3
 
 CFLAGS    += -I$(MROOT) -D __STDC_LIMIT_MACROS -D __STDC_FORMAT_MACROS
 LFLAGS    += -lz
+ifeq ($(shell uname -s),Linux)
+LFLAGS    += -lrt
+endif
 
 .PHONY : s p d r rs clean 
 
@@ -60,10 +71,10 @@ $(EXEC)_debug:		$(DCOBJS)
 $(EXEC)_release:	$(RCOBJS)
 $(EXEC)_static:		$(RCOBJS)
 
-lib$(LIB)_standard.a:	$(filter-out */Main.o,  $(COBJS))
-lib$(LIB)_profile.a:	$(filter-out */Main.op, $(PCOBJS))
-lib$(LIB)_debug.a:	$(filter-out */Main.od, $(DCOBJS))
-lib$(LIB)_release.a:	$(filter-out */Main.or, $(RCOBJS))
+lib$(LIB)_standard.a:	$(filter-out %/Main.o,  $(COBJS))
+lib$(LIB)_profile.a:	$(filter-out %/Main.op, $(PCOBJS))
+lib$(LIB)_debug.a:	$(filter-out %/Main.od, $(DCOBJS))
+lib$(LIB)_release.a:	$(filter-out %/Main.or, $(RCOBJS))
 
 
 ## Build rule
@@ -71,6 +82,13 @@ lib$(LIB)_release.a:	$(filter-out */Main.or, $(RCOBJS))
 	@echo Compiling: $(subst $(MROOT)/,,$@)
 	@$(CXX) $(CFLAGS) -c -o $@ $<
 
+ifneq ($(OBJDIR),)
+$(OBJDIR)/%.o $(OBJDIR)/%.op $(OBJDIR)/%.od $(OBJDIR)/%.or:	$(MROOT)/%.cc
+	@echo Compiling: $(subst $(PWD)/,,$@)
+	@mkdir -p $(dir $@)
+	@$(CXX) $(CFLAGS) -MMD -MP -c -o $@ $<
+endif
+
 ## Linking rules (standard/profile/debug/release)
 $(EXEC) $(EXEC)_profile $(EXEC)_debug $(EXEC)_release $(EXEC)_static:
 	@echo Linking: "$@ ( $(foreach f,$^,$(subst $(MROOT)/,,$f)) )"
@@ -89,7 +107,7 @@ libs libp libd libr:
 ## Clean rule
 clean:
 	@rm -f $(EXEC) $(EXEC)_profile $(EXEC)_debug $(EXEC)_release $(EXEC)_static \
-	  $(COBJS) $(PCOBJS) $(DCOBJS) $(RCOBJS) *.core depend.mk 
+	  $(COBJS) $(PCOBJS) $(DCOBJS) $(RCOBJS) $(COBJS:.o=.d) *.core depend.mk 
 
 ## Make dependencies
 depend.mk: $(CSRCS) $(CHDRS)
@@ -104,4 +122,8 @@ depend.mk: $(CSRCS) $(CHDRS)
 	  done
 
 -include $(MROOT)/mtl/config.mk
+ifeq ($(OBJDIR),)
 -include depend.mk
+else
+-include $(COBJS:.o=.d)
+endif
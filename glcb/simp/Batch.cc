@@ -0,0 +1,374 @@
+/***************************************************************************************[Batch.cc]
+ Same licence as the rest of Glucose (see LICENCE).
+ **************************************************************************************************/
+
+#include <errno.h>
+#include <math.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <poll.h>
+#include <sys/resource.h>
+#include <sys/time.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <zlib.h>
+#if defined(__linux__)
+#include <malloc.h>
+#endif
+
+#include "utils/System.h"
+#include "utils/Threads.h"
+#include "core/Dimacs.h"
+#include "core/ResultCache.h"
+#include "simp/SimpSolver.h"
+#include "simp/Distributed.h"
+#include "simp/Batch.h"
+
+using namespace Glucose;
+
+//=================================================================================================
+// Manifest:
+
+struct BatchJob {
+    char*   cnf;
+    char*   cmty;
+    char*   center;
+    char*   meta;
+    int     cpu;          // Seconds, INT32_MAX for no limit.
+    int     mem;          // Megabytes, INT32_MAX for no limit.
+    int64_t conflicts;    // -1 for no budget.
+};
+
+static bool readManifest(const char* path, vec<BatchJob>& jobs, int cpu_lim, int mem_lim)
+{
+    FILE* in = fopen(path, "r");
+    if (in == NULL) {
+        fprintf(stderr, "ERROR! Could not open manifest: %s\n", path);
+        return false; }
+
+    char*  line = NULL;
+    size_t cap  = 0;
+    int    nb   = 0;
+    bool   good = true;
+    while (good && getline(&line, &cap, in) != -1) {
+        nb++;
+        char* save;
+        char* tok = strtok_r(line, " \t\r\n", &save);
+        if (tok == NULL || tok[0] == '#') continue;
+
+        BatchJob j = { strdup(tok), NULL, NULL, NULL, cpu_lim, mem_lim, -1 };
+        while (good && (tok = strtok_r(NULL, " \t\r\n", &save)) != NULL) {
+            char* val = strchr(tok, '=');
+            if (val != NULL) *val++ = 0;
+            if      (val == NULL)                  good = false;
+            else if (strcmp(tok, "cmty") == 0)      j.cmty      = strdup(val);
+            else if (strcmp(tok, "center") == 0)    j.center    = strdup(val);
+            else if (strcmp(tok, "meta") == 0)      j.meta      = strdup(val);
+            else if (strcmp(tok, "cpu") == 0)       j.cpu       = atoi(val);
+            else if (strcmp(tok, "mem") == 0)       j.mem       = atoi(val);
+            else if (strcmp(tok, "conflicts") == 0) j.conflicts = atoll(val);
+            else                                   good = false;
+            if (!good)
+                fprintf(stderr, "ERROR! Manifest %s, line %d: unknown field '%s'\n", path, nb, tok);
+        }
+        jobs.push(j);
+    }
+    free(line);
+    fclose(in);
+    return good;
+}
+
+
+//=================================================================================================
+// Worker process:
+//
+// Job: job index. Result: job index, status, vars, clauses, then CPU time in microseconds,
+// conflicts, decisions, propagations and restarts as 64 bit values, then 1 if the result came from
+// the result cache (the statistics are then those of the cached solve).
+
+enum { StatusUnknown = 0, StatusSat = 10, StatusUnsat = 20, StatusTimeout = 30, StatusMemout = 31 };
+
+static Solver* volatile      batchSolver = NULL;    // Solver of the running job.
+static const char*           batchCache  = NULL;    // Result cache directory, if any.
+static volatile sig_atomic_t batchTimeout = 0;
+
+static void SIGXCPU_timeout(int signum) {
+    batchTimeout = 1;
+    if (batchSolver != NULL) batchSolver->interrupt(); }
+
+static void setTimer(int seconds) {
+    itimerval t = { { 0, 0 }, { seconds, 0 } };
+    setitimer(ITIMER_PROF, &t, NULL); }
+
+static void setLimit(int resource, rlim_t value) {
+    rlimit rl;
+    getrlimit(resource, &rl);
+    rl.rlim_cur = rl.rlim_max == RLIM_INFINITY || value < rl.rlim_max ? value : rl.rlim_max;
+    if (setrlimit(resource, &rl) == -1)
+        fprintf(stderr, "c WARNING! Could not set resource limit %d.\n", resource);
+}
+
+// Lends the job's solver to the timeout handler: the timers are disarmed and 'batchSolver' cleared
+// before the solver goes, on return and on exceptions alike (declared after it, destroyed first).
+struct JobSolver {
+    const BatchJob& j;
+    JobSolver(Solver& S, const BatchJob& j_) : j(j_) { batchSolver = &S; }
+    ~JobSolver() {
+        if (j.cpu != INT32_MAX) setTimer(0), setLimit(RLIMIT_CPU, RLIM_INFINITY);
+        batchSolver = NULL; }
+};
+
+static void runJob(const BatchJob& j, bool pre, int id, vec<int>& msg)
+{
+    double   start = cpuTime();
+    int      status = StatusUnknown, vars = 0, clauses = 0;
+    uint64_t conflicts = 0, decisions = 0, propagations = 0, restarts = 0;
+    bool     cached = false;
+    double   cpu    = 0;
+
+    // The CPU limit counts from now (the process keeps its time across jobs). The profiling timer
+    // is exact; the resource limit, in whole seconds of process time, only backs it up:
+    batchTimeout = 0;
+    if (j.cpu != INT32_MAX) setTimer(j.cpu), setLimit(RLIMIT_CPU, (rlim_t)ceil(start + j.cpu) + 1);
+    if (j.mem != INT32_MAX) {
+#if defined(__linux__)
+        malloc_trim(0);
+#endif
+        setLimit(RLIMIT_AS, (rlim_t)j.mem * 1024 * 1024); }
+
+    try {
+        SimpSolver S;
+        JobSolver  guard(S, j);
+        S.verbosity  = 0;
+        S.parsing    = 1;
+        S.cmtyFile   = j.cmty;
+        S.centerFile = j.center;
+        S.metaFile   = j.meta;
+        if (j.conflicts >= 0) S.setConfBudget(j.conflicts);
+
+        if (!parse_DIMACS_mmap(j.cnf, S, 1)) {
+            gzFile in = gzopen(j.cnf, "rb");
+            if (in == NULL)
+                fprintf(stderr, "ERROR! Could not open file: %s\n", j.cnf), _exit(1);
+            parse_DIMACS(in, S);
+            gzclose(in);
+        }
+        vars    = S.nVars();
+        clauses = S.nClauses();
+
+        ResultCache        cache(batchCache);
+        ResultCache::Entry e;
+        bool               keyed = batchCache != NULL && S.okay();
+        lbool              ret   = keyed ? cache.lookup(S, e) : l_Undef;
+        cached = ret != l_Undef;
+        if (cached) {
+            cpu          = e.cpu;
+            conflicts    = e.conflicts;
+            decisions    = e.decisions;
+            propagations = e.propagations;
+            restarts     = e.restarts;
+        } else {
+            S.parsing = 0;
+            if (pre) S.eliminate(true);
+
+            vec<Lit> dummy;
+            ret          = S.okay() ? S.solveLimited(dummy) : l_False;
+            conflicts    = S.conflicts;
+            decisions    = S.decisions;
+            propagations = S.propagations;
+            restarts     = S.starts;
+            if (keyed && ret != l_Undef) cache.store(S, ret, cpuTime() - start);
+        }
+        status = ret == l_True ? StatusSat : ret == l_False ? StatusUnsat : batchTimeout ? StatusTimeout : StatusUnknown;
+    } catch (OutOfMemoryException&) {
+        status = StatusMemout;
+    } catch (std::bad_alloc&) {
+        status = StatusMemout; }
+    if (!cached) cpu = cpuTime() - start;
+
+    if (j.cpu != INT32_MAX) setTimer(0), setLimit(RLIMIT_CPU, RLIM_INFINITY);     // If the solver was never made.
+    if (j.mem != INT32_MAX) setLimit(RLIMIT_AS,  RLIM_INFINITY);
+
+    msg.clear();
+    msg.push(id);
+    msg.push(status);
+    msg.push(vars);
+    msg.push(clauses);
+    Channel::put64(msg, (uint64_t)(cpu * 1e6));
+    Channel::put64(msg, conflicts);
+    Channel::put64(msg, decisions);
+    Channel::put64(msg, propagations);
+    Channel::put64(msg, restarts);
+    msg.push(cached);
+}
+
+static void serve(Channel& ch, const vec<BatchJob>& jobs, bool pre)
+{
+    // The solver dumps its metadata on standard output; only the coordinator writes results.
+    int devnull = open("/dev/null", O_WRONLY);
+    if (devnull >= 0) dup2(devnull, 1), close(devnull);
+    signal(SIGXCPU, SIGXCPU_timeout);
+    signal(SIGPROF, SIGXCPU_timeout);
+#if defined(__linux__)
+    // Keep freed memory in the heap, and allocate large blocks there too, for the next jobs:
+    mallopt(M_MMAP_THRESHOLD, 1 << 30);
+    mallopt(M_TRIM_THRESHOLD, INT32_MAX);
+#endif
+
+    vec<int> msg;
+    int      type;
+    for (;;) {
+        while (!ch.next(type, msg))
+            if (!ch.receive(true)) return;
+        if (type != Channel::Job) continue;
+        runJob(jobs[msg[0]], pre, msg[0], msg);
+        ch.send(Channel::Result, msg);
+        if (!ch.flush(true)) return;
+    }
+}
+
+
+//=================================================================================================
+// Coordinator:
+
+struct BatchWorker {
+    pid_t   pid;
+    Channel ch;
+    int     job;      // Running job, -1 if idle.
+    BatchWorker() : pid(-1), job(-1) { }
+};
+
+static bool spawn(BatchWorker* ws, int nworkers, int i, const vec<BatchJob>& jobs, bool pre)
+{
+    int sv[2];
+    if (socketpair(AF_UNIX, SOCK_STREAM, 0, sv) < 0) return false;
+    fflush(stdout); fflush(stderr);
+    pid_t pid = fork();
+    if (pid < 0) {
+        close(sv[0]); close(sv[1]);
+        return false; }
+
+    if (pid == 0) {
+        close(sv[0]);
+        for (int k = 0; k < nworkers; k++)
+            if (ws[k].ch.socket() >= 0) close(ws[k].ch.socket());
+        Channel ch;
+        ch.open(sv[1]);
+        serve(ch, jobs, pre);
+        _exit(0);
+    }
+
+    close(sv[1]);
+    ws[i].pid = pid;
+    ws[i].job = -1;
+    ws[i].ch.open(sv[0]);
+    return true;
+}
+
+static void printJson(FILE* out, const char* s)
+{
+    fputc('"', out);
+    for (; *s; s++)
+        if (*s == '"' || *s == '\\')        fprintf(out, "\\%c", *s);
+        else if ((unsigned char)*s < 0x20)  fprintf(out, "\\u%04x", (unsigned char)*s);
+        else                                fputc(*s, out);
+    fputc('"', out);
+}
+
+int Glucose::solveBatch(const char* manifest, const char* outPath, int nworkers, int cpu_lim, int mem_lim, bool pre,
+                        const char* cache)
+{
+    batchCache = cache;
+    vec<BatchJob> jobs;
+    if (!readManifest(manifest, jobs, cpu_lim, mem_lim)) return 1;
+    FILE* out = outPath ? fopen(outPath, "w") : stdout;
+    if (out == NULL) {
+        fprintf(stderr, "ERROR! Could not open file: %s\n", outPath);
+        return 1; }
+
+    nworkers = effectiveThreads(nworkers);
+    if (nworkers > jobs.size()) nworkers = jobs.size() > 0 ? jobs.size() : 1;
+
+    BatchWorker*  ws = new BatchWorker[nworkers];
+    vec<int>      msg, live;
+    vec<pollfd>   fds;
+    int           nextJob = 0, running = 0, type;
+    const char*   names[] = { "UNKNOWN", "SAT", "UNSAT", "TIMEOUT", "MEMOUT" };
+
+    while (nextJob < jobs.size() || running > 0) {
+        for (int i = 0; i < nworkers && nextJob < jobs.size(); i++) {
+            if (ws[i].pid < 0 && !spawn(ws, nworkers, i, jobs, pre)) continue;
+            if (ws[i].job >= 0) continue;
+            msg.clear();
+            msg.push(nextJob);
+            ws[i].ch.send(Channel::Job, msg);
+            ws[i].job = nextJob++;
+            running++;
+        }
+
+        fds.clear(); live.clear();
+        for (int i = 0; i < nworkers; i++)
+            if (ws[i].pid > 0) {
+                pollfd p = { ws[i].ch.socket(), (short)(POLLIN | (ws[i].ch.pending() > 0 ? POLLOUT : 0)), 0 };
+                fds.push(p);
+                live.push(i); }
+        if (fds.size() == 0) {
+            fprintf(stderr, "ERROR! Could not start a worker process.\n");
+            break; }
+        if (::poll((pollfd*)fds, fds.size(), -1) < 0 && errno != EINTR) break;
+
+        for (int f = 0; f < fds.size(); f++) {
+            BatchWorker& w     = ws[live[f]];
+            bool         alive = true;
+            if (fds[f].revents & POLLOUT)                        alive = w.ch.flush(false);
+            if (fds[f].revents & (POLLIN | POLLHUP | POLLERR))   alive = w.ch.receive(false) && alive;
+
+            while (w.ch.next(type, msg)) {
+                if (type != Channel::Result || msg[0] != w.job) continue;
+                int st = msg[1];
+                fprintf(out, "{\"id\":%d,\"cnf\":", msg[0]);
+                printJson(out, jobs[msg[0]].cnf);
+                fprintf(out, ",\"status\":\"%s\",\"cpu\":%.6f,\"vars\":%d,\"clauses\":%d,\"conflicts\":%" PRIu64
+                        ",\"decisions\":%" PRIu64",\"propagations\":%" PRIu64",\"restarts\":%" PRIu64",\"cached\":%s}\n",
+                        names[st == StatusSat ? 1 : st == StatusUnsat ? 2 : st == StatusTimeout ? 3 : st == StatusMemout ? 4 : 0],
+                        Channel::get64(msg, 4) / 1e6, msg[2], msg[3],
+                        Channel::get64(msg, 6), Channel::get64(msg, 8), Channel::get64(msg, 10), Channel::get64(msg, 12),
+                        msg[14] ? "true" : "false");
+                fflush(out);
+                w.job = -1;
+                running--;
+            }
+
+            if (!alive) {
+                int status;
+                w.ch.close();
+                waitpid(w.pid, &status, 0);
+                if (w.job >= 0) {
+                    fprintf(out, "{\"id\":%d,\"cnf\":", w.job);
+                    printJson(out, jobs[w.job].cnf);
+                    fprintf(out, ",\"status\":\"ERROR\",\"%s\":%d}\n", WIFSIGNALED(status) ? "signal" : "exit",
+                            WIFSIGNALED(status) ? WTERMSIG(status) : WEXITSTATUS(status));
+                    fflush(out);
+                    running--;
+                }
+                w.pid = -1;
+                w.job = -1;
+            }
+        }
+    }
+
+    for (int i = 0; i < nworkers; i++)
+        if (ws[i].pid > 0) {
+            ws[i].ch.close();           // End of stream: the worker exits.
+            waitpid(ws[i].pid, NULL, 0); }
+    delete [] ws;
+    if (out != stdout) fclose(out);
+
+    for (int i = 0; i < jobs.size(); i++) {
+        free(jobs[i].cnf); free(jobs[i].cmty); free(jobs[i].center); free(jobs[i].meta); }
+    return 0;
+}
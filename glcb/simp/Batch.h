@@ -0,0 +1,43 @@
+/****************************************************************************************[Batch.h]
+ Batch mode: many formulas solved by a fixed pool of long-running worker processes.
+
+ Same licence as the rest of Glucose (see LICENCE).
+ **************************************************************************************************/
+
+#ifndef Glucose_Batch_h
+#define Glucose_Batch_h
+
+namespace Glucose {
+
+//=================================================================================================
+// solveBatch -- solve every job of a manifest, writing one JSON line per job:
+//
+// A manifest line is a CNF path (plain or gzipped) followed by optional fields:
+//
+//   cmty=FILE  center=FILE  meta=FILE   metadata side files (as -cmty-file, -center-file, -meta-file)
+//   cpu=SEC    mem=MB                   limits of the job (default: -cpu-lim, -mem-lim)
+//   conflicts=N                         conflict budget of the job (default: none)
+//
+// Blank lines and lines starting with '#' are skipped; relative paths are taken from the current
+// directory. 'nworkers' processes (0 = one per core) are forked once, after option parsing, and
+// each solves one job at a time with a fresh solver; they keep their heap between jobs (no trimming,
+// no mmap for large blocks), so the clause arenas and vectors of a job reuse the pages of the jobs
+// before it. A job that hits its CPU limit reports TIMEOUT, one that runs out of memory MEMOUT; a
+// worker that dies (parse error, missing side file, crash) reports ERROR and is replaced.
+//
+// With a 'cache' directory, a job whose formula is in the result cache (core/ResultCache.h) is
+// answered from it without solving, and solved jobs are added to it.
+//
+// Results go to 'out' (standard output if NULL) in completion order, flushed line by line:
+//   {"id":0,"cnf":"a.cnf","status":"SAT","cpu":0.12,"vars":..,"clauses":..,"conflicts":..,
+//    "decisions":..,"propagations":..,"restarts":..,"cached":false}
+// The statistics of a cached job are those of the solve that filled the cache.
+// Returns 0, or 1 if the manifest or the output file could not be opened.
+
+int solveBatch(const char* manifest, const char* out, int nworkers, int cpu_lim, int mem_lim, bool pre,
+               const char* cache = NULL);
+
+//=================================================================================================
+}
+
+#endif
@@ -0,0 +1,102 @@
+/****************************************************************************************[CApi.cc]
+ Same licence as the rest of Glucose (see LICENCE).
+ **************************************************************************************************/
+
+#include <new>
+#include <string.h>
+
+#include "core/Solver.h"
+#include "simp/CApi.h"
+
+using namespace Glucose;
+
+struct glcb_solver {
+    Solver   S;
+    vec<Lit> lits;
+    int64_t  budget;      // Conflicts per 'glcb_solve', -1 for none.
+    glcb_solver() : budget(-1) { S.verbosity = 0; }
+
+    Lit lit(int l) {
+        int v = abs(l) - 1;
+        while (v >= S.nVars()) S.newVar();
+        return mkLit(v, l < 0); }
+
+    void load(const int* ls, int n) {
+        lits.clear();
+        for (int i = 0; i < n; i++) lits.push(lit(ls[i])); }
+};
+
+glcb_solver* glcb_new(void) { return new (std::nothrow) glcb_solver(); }
+
+void glcb_delete(glcb_solver* s) { delete s; }
+
+int glcb_set_param(glcb_solver* s, const char* name, double value)
+{
+    if      (strcmp(name, "verbosity") == 0)        s->S.verbosity       = (int)value;
+    else if (strcmp(name, "bump-policy") == 0)      s->S.bumpPolicy      = (int)value;
+    else if (strcmp(name, "center-decisions") == 0) s->S.centerDecisions = (int)value;
+    else if (strcmp(name, "threads") == 0)          s->S.searchThreads   = (int)value;
+    else if (strcmp(name, "cube-depth") == 0)       s->S.cubeDepth       = (int)value;
+    else if (strcmp(name, "seed") == 0)             s->S.random_seed     = value;
+    else if (strcmp(name, "conflicts") == 0)        s->budget            = (int64_t)value;
+    else return 0;
+    return 1;
+}
+
+int glcb_add_clause(glcb_solver* s, const int* lits, int n)
+{
+    try {
+        s->load(lits, n);
+        return s->S.addClause_(s->lits) ? 1 : 0;
+    } catch (OutOfMemoryException&) { return -1; }
+}
+
+void glcb_set_communities(glcb_solver* s, const int* cmty, int nvars)
+{
+    s->S.setCommunityHints(cmty, nvars);
+}
+
+void glcb_set_centrality(glcb_solver* s, const double* centrality, int nvars)
+{
+    s->S.setCentralityHints(centrality, nvars);
+}
+
+void glcb_set_bridges(glcb_solver* s, const unsigned char* bridge, int nvars)
+{
+    vec<bool> b(nvars);
+    for (int i = 0; i < nvars; i++) b[i] = bridge[i] != 0;
+    s->S.setBridgeHints((bool*)b, nvars);
+}
+
+int glcb_solve(glcb_solver* s, const int* assumps, int n)
+{
+    try {
+        s->load(assumps, n);
+        if (s->budget >= 0) s->S.setConfBudget(s->budget);
+        else                s->S.budgetOff();
+        lbool r = s->S.solveLimited(s->lits);
+        s->S.clearInterrupt();
+        return r == l_True ? 10 : r == l_False ? 20 : 0;
+    } catch (OutOfMemoryException&) { return -1; }
+}
+
+int glcb_value(glcb_solver* s, int lit)
+{
+    int v = abs(lit) - 1;
+    if (v < 0 || v >= s->S.model.size() || s->S.model[v] == l_Undef) return 0;
+    return (s->S.model[v] == l_True) == (lit > 0) ? lit : -lit;
+}
+
+int glcb_failed(glcb_solver* s, int lit)
+{
+    int v = abs(lit) - 1;
+    if (v < 0 || v >= s->S.nVars()) return 0;
+    Lit p = ~mkLit(v, lit < 0);
+    for (int i = 0; i < s->S.conflict.size(); i++)
+        if (s->S.conflict[i] == p) return 1;
+    return 0;
+}
+
+void glcb_interrupt(glcb_solver* s) { s->S.interrupt(); }
+
+int glcb_nvars(glcb_solver* s) { return s->S.nVars(); }
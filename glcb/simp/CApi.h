@@ -0,0 +1,61 @@
+/*****************************************************************************************[CApi.h]
+ C interface of the solver, for embedding it as a library ('make libr' in simp/).
+
+ Same licence as the rest of Glucose (see LICENCE).
+ **************************************************************************************************/
+
+#ifndef Glucose_CApi_h
+#define Glucose_CApi_h
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Bumped on incompatible changes of the functions below.
+#define GLCB_API_VERSION 1
+
+// A solver instance. Instances are independent: they read no file and no global option (the
+// defaults of the command line options are used), so any number may live in one process, each
+// used by one thread at a time ('glcb_interrupt' excepted).
+typedef struct glcb_solver glcb_solver;
+
+glcb_solver* glcb_new    (void);
+void         glcb_delete (glcb_solver* s);
+
+// Parameters: "verbosity", "bump-policy", "center-decisions", "threads", "cube-depth", "seed",
+// and "conflicts" (conflict budget of each later 'glcb_solve', negative for none).
+// Returns 0 if 'name' is unknown.
+int          glcb_set_param (glcb_solver* s, const char* name, double value);
+
+// Literals are DIMACS style: variable v > 0 as v or -v. Variables are created as they appear.
+// Returns 0 if the formula became trivially unsatisfiable, -1 if memory ran out, 1 otherwise.
+int          glcb_add_clause(glcb_solver* s, const int* lits, int n);
+
+// Graph hints, entry i for variable i+1, used instead of detecting them; the arrays are copied.
+// Community ids lie in 0 .. #variables-1 and are read by the first 'glcb_solve' only; centralities
+// and bridge flags may also be changed between solves.
+void         glcb_set_communities(glcb_solver* s, const int*           cmty,       int nvars);
+void         glcb_set_centrality (glcb_solver* s, const double*        centrality, int nvars);
+void         glcb_set_bridges    (glcb_solver* s, const unsigned char* bridge,     int nvars);
+
+// Solves under the assumptions: 10 (SAT), 20 (UNSAT), 0 (budget reached or interrupted) or -1
+// (out of memory).
+int          glcb_solve    (glcb_solver* s, const int* assumps, int n);
+
+// After SAT: 'lit' if it is true in the model, '-lit' if false, 0 if unassigned (or 'lit' is 0).
+int          glcb_value    (glcb_solver* s, int lit);
+
+// After UNSAT: 1 if the assumption 'lit' takes part in the final conflict, else 0.
+int          glcb_failed   (glcb_solver* s, int lit);
+
+// Makes a running 'glcb_solve' return 0 at its next conflict; may be called from any thread or
+// signal handler.
+void         glcb_interrupt(glcb_solver* s);
+
+int          glcb_nvars    (glcb_solver* s);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
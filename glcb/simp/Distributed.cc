@@ -0,0 +1,434 @@
+/*********************************************************************************[Distributed.cc]
+ Same licence as the rest of Glucose (see LICENCE).
+ **************************************************************************************************/
+
+#include <errno.h>
+#include <signal.h>
+#include <string.h>
+#include <unistd.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+
+#include "utils/Options.h"
+#include "core/Cubes.h"
+#include "simp/Distributed.h"
+
+using namespace Glucose;
+
+static IntOption opt_dist_lbd  ("MAIN", "dist-share-lbd",  "Workers send the learnt clauses of LBD at most this to the coordinator", 2, IntRange(0, INT32_MAX));
+static IntOption opt_dist_size ("MAIN", "dist-share-size", "Workers send the learnt clauses of size at most this to the coordinator", 8, IntRange(0, INT32_MAX));
+
+//=================================================================================================
+// Channel:
+
+Channel::~Channel() { close(); }
+
+void Channel::open(int f)
+{
+    fd = f;
+    in.clear(); out.clear();
+    inHead = 0;
+}
+
+void Channel::close()
+{
+    if (fd >= 0) ::close(fd);
+    fd = -1;
+}
+
+void Channel::send(int type, const vec<int>& payload)
+{
+    int32_t n   = payload.size();
+    int     pos = out.size();
+    out.growTo(pos + 5 + 4 * n);
+    out[pos] = (char)type;
+    memcpy((char*)out + pos + 1, &n, 4);
+    if (n > 0) memcpy((char*)out + pos + 5, &payload[0], 4 * n);
+}
+
+bool Channel::flush(bool block)
+{
+    int done = 0;
+    while (done < out.size()) {
+        ssize_t k = ::send(fd, (char*)out + done, out.size() - done, MSG_NOSIGNAL | (block ? 0 : MSG_DONTWAIT));
+        if (k >= 0) { done += k; continue; }
+        if (errno == EINTR) continue;
+        if (errno == EAGAIN || errno == EWOULDBLOCK) break;
+        return false;
+    }
+    if (done > 0) {
+        memmove((char*)out, (char*)out + done, out.size() - done);
+        out.shrink(done);
+    }
+    return true;
+}
+
+bool Channel::receive(bool block)
+{
+    if (inHead == in.size()) in.clear(), inHead = 0;
+    else if (inHead > (1 << 16)) {
+        memmove((char*)in, (char*)in + inHead, in.size() - inHead);
+        in.shrink(inHead);
+        inHead = 0; }
+
+    char buf[1 << 16];
+    for (;;) {
+        ssize_t k = ::recv(fd, buf, sizeof(buf), block ? 0 : MSG_DONTWAIT);
+        if (k > 0) {
+            int pos = in.size();
+            in.growTo(pos + k);
+            memcpy((char*)in + pos, buf, k);
+            if (block) return true;
+            continue; }
+        if (k == 0) return false;
+        if (errno == EINTR) continue;
+        return errno == EAGAIN || errno == EWOULDBLOCK;
+    }
+}
+
+bool Channel::next(int& type, vec<int>& payload)
+{
+    int avail = in.size() - inHead;
+    if (avail < 5) return false;
+    int32_t n;
+    memcpy(&n, (char*)in + inHead + 1, 4);
+    if (avail < 5 + 4 * n) return false;
+
+    type = in[inHead];
+    payload.clear();
+    payload.growTo(n);
+    if (n > 0) memcpy((int*)payload, (char*)in + inHead + 5, 4 * n);
+    inHead += 5 + 4 * n;
+    return true;
+}
+
+
+//=================================================================================================
+// Messages:
+//
+//   Job    (coordinator -> worker): job id, strategy (-1 for a cube), cube literals.
+//   Clause (both ways):             LBD, literals.
+//   Result (worker -> coordinator): job id, status, conflicts, decisions, propagations (each as
+//                                   two 32 bit halves), then for SAT the model, 16 variables a word.
+//
+// Status: 10 SAT, 20 UNSAT, 21 cube refuted, 0 interrupted. A worker quits at the end of stream.
+
+enum { StatusUnknown = 0, StatusSat = 10, StatusUnsat = 20, StatusRefuted = 21 };
+
+
+//=================================================================================================
+// DistWorker -- the solver of a worker process:
+
+namespace Glucose {
+
+class DistWorker : public SimpSolver {
+    Channel&  ch;
+    vec<int>  msg;
+    vec<int>  inbox;      // Received clauses, each as size, LBD, literals.
+    vec<Lit>  tmp;
+    int       basePolicy;
+    double    baseSeed;
+    int       polls;
+    bool      quit;       // The coordinator is gone.
+
+    void dispatch(int type);
+    void exchange();      // Flush the messages to send, take in the received ones.
+    void runJob();
+
+public:
+    DistWorker(const SimpSolver& s, Channel& c);
+
+    void serve();         // Run the jobs sent by the coordinator until it closes the channel.
+
+    virtual bool parallelJobIsFinished();
+    virtual bool parallelImportClauses();
+    virtual void parallelExportUnaryClause(Lit p);
+    virtual void parallelExportClauseDuringSearch(Clause& c);
+};
+
+}
+
+DistWorker::DistWorker(const SimpSolver& s, Channel& c) :
+    SimpSolver(s), ch(c), basePolicy(s.bumpPolicy), baseSeed(s.random_seed), polls(0), quit(false)
+{
+    verbosity     = 0;
+    searchThreads = 1;
+    cubeDepth     = 0;
+}
+
+void DistWorker::dispatch(int type)
+{
+    if (type != Channel::Clause) return;
+    inbox.push(msg.size() - 1);
+    for (int i = 0; i < msg.size(); i++) inbox.push(msg[i]);
+}
+
+void DistWorker::exchange()
+{
+    int type;
+    if (!ch.flush(true) || !ch.receive(false)) quit = true;
+    while (ch.next(type, msg)) dispatch(type);
+}
+
+bool DistWorker::parallelJobIsFinished() {
+    if (++polls % 64 == 0) exchange();
+    if (quit) interrupt();    // Makes 'solve_' leave its restart loop.
+    return quit;
+}
+
+void DistWorker::parallelExportUnaryClause(Lit p) {
+    msg.clear();
+    msg.push(1);
+    msg.push(toInt(p));
+    ch.send(Channel::Clause, msg);
+}
+
+void DistWorker::parallelExportClauseDuringSearch(Clause& c) {
+    if ((int)c.lbd() > opt_dist_lbd && c.size() > opt_dist_size) return;
+    msg.clear();
+    msg.push(c.lbd());
+    for (int i = 0; i < c.size(); i++) msg.push(toInt(c[i]));
+    ch.send(Channel::Clause, msg);
+}
+
+// Called at decision level 0: returns TRUE if a received clause is falsified by the root facts.
+bool DistWorker::parallelImportClauses() {
+    exchange();
+    bool empty = false;
+    for (int i = 0; i < inbox.size() && !empty; i += inbox[i] + 2) {
+        tmp.clear();
+        for (int j = i + 2; j < i + 2 + inbox[i]; j++) tmp.push(toLit(inbox[j]));
+        empty = !importLearnt(tmp, inbox[i + 1]);
+    }
+    inbox.clear();
+    return empty;
+}
+
+void DistWorker::runJob()
+{
+    int id = msg[0], strategy = msg[1];
+    if (strategy >= 0) {
+        bumpPolicy  = (basePolicy + strategy) % (BumpNone + 1);
+        random_seed = baseSeed + 1000 * strategy;
+        if (strategy > BumpNone) {
+            for (int v = 0; v < nVars(); v++)
+                activity[v] += drand(random_seed) * 0.00001;
+            rebuildOrderHeap();
+        }
+        computeBumpMult();
+    }
+    vec<Lit> cube;
+    for (int i = 2; i < msg.size(); i++) cube.push(toLit(msg[i]));
+
+    uint64_t c0 = conflicts, d0 = decisions, p0 = propagations;
+    lbool    r  = l_False;
+    conflict.clear();
+    if (!ok || parallelImportClauses()) ok = false;
+    else r = solveLimited(cube);
+
+    msg.clear();
+    msg.push(id);
+    msg.push(r == l_True ? StatusSat : r == l_Undef ? StatusUnknown : conflict.size() > 0 ? StatusRefuted : StatusUnsat);
+    Channel::put64(msg, conflicts - c0);
+    Channel::put64(msg, decisions - d0);
+    Channel::put64(msg, propagations - p0);
+    if (r == l_True)
+        for (int v = 0; v < model.size(); v++) {
+            if (v % 16 == 0) msg.push(0);
+            msg.last() |= toInt(model[v]) << (2 * (v % 16));
+        }
+    ch.send(Channel::Result, msg);
+    ch.flush(true);
+}
+
+void DistWorker::serve()
+{
+    int type;
+    while (!quit) {
+        while (!ch.next(type, msg))
+            if (!ch.receive(true)) return;
+        if (type == Channel::Job) runJob();
+        else                      dispatch(type);
+    }
+}
+
+
+//=================================================================================================
+// Coordinator:
+
+struct Worker {
+    pid_t   pid;
+    Channel ch;
+    int     job;      // Running job, -1 if idle.
+    Worker() : pid(-1), job(-1) { }
+};
+
+static bool spawn(SimpSolver& S, Worker* ws, int nworkers, int i)
+{
+    int sv[2];
+    if (socketpair(AF_UNIX, SOCK_STREAM, 0, sv) < 0) return false;
+    fflush(stdout); fflush(stderr);
+    pid_t pid = fork();
+    if (pid < 0) {
+        close(sv[0]); close(sv[1]);
+        return false; }
+
+    if (pid == 0) {
+        // Worker process: the coordinator handles SIGINT; -cpu-lim ends the worker itself.
+        signal(SIGINT,  SIG_IGN);
+        signal(SIGXCPU, SIG_DFL);
+        close(sv[0]);
+        for (int k = 0; k < nworkers; k++)
+            if (ws[k].ch.socket() >= 0) close(ws[k].ch.socket());
+        int code = 0;
+        try {
+            Channel    ch;
+            ch.open(sv[1]);
+            DistWorker w(S, ch);
+            w.serve();
+        } catch (OutOfMemoryException&) { code = 3; }
+        _exit(code);
+    }
+
+    close(sv[1]);
+    ws[i].pid = pid;
+    ws[i].job = -1;
+    ws[i].ch.open(sv[0]);
+    return true;
+}
+
+lbool Glucose::solveDistributed(SimpSolver& S, int nworkers, int retries)
+{
+    S.initMetadata();
+
+    // Jobs, each followed by lit_Undef in 'jobLits':
+    vec<Lit>  jobLits;
+    vec<int>  jobStart;
+    bool      cubes = S.cubeDepth > 0;
+    if (cubes) {
+        CubeAndConquer cc(S, 1, S.cubeDepth, S.cubeCands);
+        lbool gen = cc.generate();
+        if (gen != l_True)     return gen;        // Refuted, or interrupted with partial cubes.
+        if (cc.cubes() == 0)   return l_False;    // Every branch refuted by lookahead.
+        vec<Lit> c;
+        for (int i = 0; i < cc.cubes(); i++) {
+            cc.cube(i, c);
+            jobStart.push(jobLits.size());
+            for (int j = 0; j < c.size(); j++) jobLits.push(c[j]);
+            jobLits.push(lit_Undef);
+        }
+    } else
+        for (int i = 0; i < nworkers; i++) {
+            jobStart.push(jobLits.size());
+            jobLits.push(lit_Undef);
+        }
+
+    int       njobs = jobStart.size();
+    vec<int>  tries(njobs, 0), queue;
+    vec<bool> done(njobs, false);
+    for (int j = njobs - 1; j >= 0; j--) queue.push(j);
+    if (S.verbosity > 0)
+        printf("c | Distributed: %d %s on %d workers                                                              |\n",
+               njobs, cubes ? "cubes" : "strategies", nworkers);
+
+    Worker*       ws = new Worker[nworkers];
+    vec<int>      msg, live;
+    vec<pollfd>   fds;
+    lbool         result = l_Undef;
+    int           open = njobs, refuted = 0, abandoned = 0, deaths = 0, type;
+    uint64_t      relayed = 0;
+
+    while (result == l_Undef && open > 0 && !S.interrupted()) {
+        // Replace dead workers while jobs wait, and hand out the jobs:
+        for (int i = 0; i < nworkers && queue.size() > 0; i++) {
+            if (ws[i].pid < 0 && !spawn(S, ws, nworkers, i)) continue;
+            if (ws[i].job >= 0) continue;
+            int j = queue.last(); queue.pop();
+            msg.clear();
+            msg.push(j);
+            msg.push(cubes ? -1 : j);
+            for (int k = jobStart[j]; jobLits[k] != lit_Undef; k++) msg.push(toInt(jobLits[k]));
+            ws[i].ch.send(Channel::Job, msg);
+            ws[i].job = j;
+        }
+
+        fds.clear(); live.clear();
+        for (int i = 0; i < nworkers; i++)
+            if (ws[i].pid > 0) {
+                pollfd p = { ws[i].ch.socket(), (short)(POLLIN | (ws[i].ch.pending() > 0 ? POLLOUT : 0)), 0 };
+                fds.push(p);
+                live.push(i); }
+        if (fds.size() == 0) break;     // No worker could be started.
+        if (::poll((pollfd*)fds, fds.size(), 100) < 0 && errno != EINTR) break;
+
+        for (int f = 0; f < fds.size(); f++) {
+            Worker& w     = ws[live[f]];
+            bool    alive = true;
+            if (fds[f].revents & POLLOUT)                        alive = w.ch.flush(false);
+            if (fds[f].revents & (POLLIN | POLLHUP | POLLERR))   alive = w.ch.receive(false) && alive;
+
+            while (result == l_Undef && w.ch.next(type, msg)) {
+                if (type == Channel::Clause) {
+                    // Keep units for the workers to come, pass everything on to the running ones:
+                    if (msg.size() == 2 && !S.addClause(toLit(msg[1]))) result = l_False;
+                    for (int k = 0; k < nworkers; k++)
+                        if (ws[k].pid > 0 && &ws[k] != &w && ws[k].ch.pending() < (1 << 22)) {
+                            ws[k].ch.send(Channel::Clause, msg);
+                            relayed++; }
+                } else if (type == Channel::Result && msg[0] == w.job) {
+                    S.conflicts    += Channel::get64(msg, 2);
+                    S.decisions    += Channel::get64(msg, 4);
+                    S.propagations += Channel::get64(msg, 6);
+                    w.job = -1;
+                    switch (msg[1]) {
+                    case StatusSat:
+                        S.model.growTo(S.nVars());
+                        for (int v = 0; v < S.nVars(); v++)
+                            S.model[v] = toLbool((msg[8 + v / 16] >> (2 * (v % 16))) & 3);
+                        result = l_True;
+                        break;
+                    case StatusUnsat:
+                        result = l_False;
+                        break;
+                    case StatusRefuted:
+                        done[msg[0]] = true;
+                        open--, refuted++;
+                        break;
+                    default:
+                        queue.push(msg[0]);
+                    }
+                }
+            }
+
+            if (!alive) {
+                int status;
+                w.ch.close();
+                waitpid(w.pid, &status, 0);
+                deaths++;
+                if (S.verbosity > 0)
+                    printf("c | Worker %d died (%s %d) during job %d\n", live[f],
+                           WIFSIGNALED(status) ? "signal" : "exit", WIFSIGNALED(status) ? WTERMSIG(status) : WEXITSTATUS(status), w.job);
+                if (w.job >= 0 && !done[w.job]) {
+                    if (++tries[w.job] <= retries) queue.push(w.job);
+                    else open--, abandoned++;
+                }
+                w.pid = -1;
+                w.job = -1;
+            }
+        }
+    }
+    if (result == l_Undef && njobs > 0 && open == 0 && abandoned == 0) result = l_False;
+
+    for (int i = 0; i < nworkers; i++)
+        if (ws[i].pid > 0) {
+            kill(ws[i].pid, SIGKILL);
+            ws[i].ch.close();
+            waitpid(ws[i].pid, NULL, 0); }
+    delete [] ws;
+
+    if (S.verbosity > 0)
+        printf("c distributed           : %d workers, %d jobs (%d refuted, %d abandoned), %d worker deaths, %" PRIu64" clauses relayed\n",
+               nworkers, njobs, refuted, abandoned, deaths, relayed);
+    return result;
+}
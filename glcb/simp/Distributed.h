@@ -0,0 +1,68 @@
+/**********************************************************************************[Distributed.h]
+ Distributed solving: a coordinator process hands parts of the search to worker processes over
+ Unix-domain sockets.
+
+ Same licence as the rest of Glucose (see LICENCE).
+ **************************************************************************************************/
+
+#ifndef Glucose_Distributed_h
+#define Glucose_Distributed_h
+
+#include <stdint.h>
+
+#include "mtl/Vec.h"
+#include "simp/SimpSolver.h"
+
+namespace Glucose {
+
+//=================================================================================================
+// Channel -- framed binary messages over a stream socket:
+//
+// A message is a 1 byte type, a 4 byte payload size and the payload. Lits travel as 'toInt(lit)'
+// (coordinator and workers come from the same process image, so variables agree). Sends are
+// buffered until 'flush'; 'receive' reads what the socket has without blocking unless asked to.
+
+class Channel {
+    int       fd;
+    vec<char> in, out;
+    int       inHead;
+
+public:
+    enum { Job = 1, Clause = 2, Result = 3, Stop = 4, Quit = 5 };
+
+    Channel() : fd(-1), inHead(0) { }
+    ~Channel();
+
+    void open (int f);
+    void close();
+    int  socket() const { return fd; }
+    int  pending() const { return out.size(); }
+
+    void send   (int type, const vec<int>& payload);
+    bool flush  (bool block);                      // FALSE if the peer is gone.
+    bool receive(bool block);                      // Read from the socket; FALSE on end of stream.
+    bool next   (int& type, vec<int>& payload);    // Pop a complete received message, if any.
+
+    // 64 bit values travel as two words:
+    static void     put64(vec<int>& msg, uint64_t x) { msg.push((int)(uint32_t)x); msg.push((int)(uint32_t)(x >> 32)); }
+    static uint64_t get64(const vec<int>& msg, int i) { return (uint64_t)(uint32_t)msg[i] | ((uint64_t)(uint32_t)msg[i + 1] << 32); }
+};
+
+
+//=================================================================================================
+// solveDistributed -- solve 'S' with 'nworkers' forked worker processes:
+//
+// 'S' must be simplified already (elimination turned off). The coordinator partitions the search
+// into jobs: the cubes of a bridge/high-center lookahead (core/Cubes.h) when 'S.cubeDepth' > 0,
+// otherwise one job per worker running bump policy (S.bumpPolicy + job) mod 4 with its own seed.
+// Workers stream back their result, learnt units and low-LBD clauses; the coordinator relays the
+// clauses to the other workers and keeps the units. A worker that crashes or dies on its memory
+// limit (-mem-lim applies to each process) is replaced and its job given again, up to 'retries'
+// times. The model, if any, is copied to 'S' and the workers' statistics are added to it.
+
+lbool solveDistributed(SimpSolver& S, int nworkers, int retries);
+
+//=================================================================================================
+}
+
+#endif
@@ -0,0 +1,144 @@
+/**************************************************************************************[Ipasir.cc]
+ Same licence as the rest of Glucose (see LICENCE).
+ **************************************************************************************************/
+
+#include "core/Solver.h"
+#include "simp/Ipasir.h"
+
+using namespace Glucose;
+
+//=================================================================================================
+// IpasirSolver -- a Solver with the IPASIR state, calling back through the parallel hooks:
+
+namespace Glucose {
+
+class IpasirSolver : public Solver {
+    vec<int32_t> learnt;
+
+public:
+    vec<Lit> clause, assumps;
+    void*    termData;
+    int    (*terminate)(void* data);
+    void*    learnData;
+    int      learnMax;
+    void   (*learn)(void* data, int32_t* clause);
+
+    IpasirSolver() : termData(NULL), terminate(NULL), learnData(NULL), learnMax(0), learn(NULL) {
+        verbosity     = 0;
+        searchThreads = 1;      // The callbacks run in the caller's thread.
+        cubeDepth     = 0;
+    }
+
+    Lit lit(int32_t l) {
+        int v = abs(l) - 1;
+        while (v >= nVars()) newVar();
+        return mkLit(v, l < 0); }
+
+    void export_(const Lit* ps, int n);
+
+    virtual bool parallelJobIsFinished();
+    virtual void parallelExportUnaryClause(Lit p);
+    virtual void parallelExportClauseDuringSearch(Clause& c);
+};
+
+}
+
+bool IpasirSolver::parallelJobIsFinished() {
+    if (terminate == NULL || !terminate(termData)) return false;
+    interrupt();    // Makes 'solve_' leave its restart loop.
+    return true;
+}
+
+void IpasirSolver::export_(const Lit* ps, int n) {
+    if (learn == NULL || n > learnMax) return;
+    learnt.clear();
+    for (int i = 0; i < n; i++) learnt.push(sign(ps[i]) ? -(var(ps[i]) + 1) : var(ps[i]) + 1);
+    learnt.push(0);
+    learn(learnData, (int32_t*)learnt);
+}
+
+void IpasirSolver::parallelExportUnaryClause(Lit p) { export_(&p, 1); }
+
+void IpasirSolver::parallelExportClauseDuringSearch(Clause& c) { export_((const Lit*)c, c.size()); }
+
+
+//=================================================================================================
+// IPASIR:
+
+static inline IpasirSolver& get(void* s) { return *(IpasirSolver*)s; }
+
+const char* ipasir_signature(void) { return "glucose-4.0-prefbump"; }
+
+void* ipasir_init(void) { return new IpasirSolver(); }
+
+void ipasir_release(void* solver) { delete &get(solver); }
+
+void ipasir_add(void* solver, int32_t lit)
+{
+    IpasirSolver& S = get(solver);
+    if (lit != 0) { S.clause.push(S.lit(lit)); return; }
+    S.addClause_(S.clause);
+    S.clause.clear();
+}
+
+void ipasir_assume(void* solver, int32_t lit)
+{
+    IpasirSolver& S = get(solver);
+    S.assumps.push(S.lit(lit));
+}
+
+int ipasir_solve(void* solver)
+{
+    IpasirSolver& S = get(solver);
+    S.budgetOff();
+    lbool r = S.solveLimited(S.assumps);
+    S.clearInterrupt();
+    S.assumps.clear();
+    return r == l_True ? 10 : r == l_False ? 20 : 0;
+}
+
+int32_t ipasir_val(void* solver, int32_t lit)
+{
+    IpasirSolver& S = get(solver);
+    int v = abs(lit) - 1;
+    if (v < 0 || v >= S.model.size() || S.model[v] == l_Undef) return 0;
+    return (S.model[v] == l_True) == (lit > 0) ? lit : -lit;
+}
+
+int ipasir_failed(void* solver, int32_t lit)
+{
+    IpasirSolver& S = get(solver);
+    int v = abs(lit) - 1;
+    if (v < 0 || v >= S.nVars()) return 0;
+    Lit p = ~mkLit(v, lit < 0);
+    for (int i = 0; i < S.conflict.size(); i++)
+        if (S.conflict[i] == p) return 1;
+    return 0;
+}
+
+void ipasir_set_terminate(void* solver, void* data, int (*terminate)(void* data))
+{
+    IpasirSolver& S = get(solver);
+    S.termData  = data;
+    S.terminate = terminate;
+}
+
+void ipasir_set_learn(void* solver, void* data, int max_length, void (*learn)(void* data, int32_t* clause))
+{
+    IpasirSolver& S = get(solver);
+    S.learnData = data;
+    S.learnMax  = max_length;
+    S.learn     = learn;
+}
+
+void ipasir_glcb_set_priority(void* solver, const double* weight, int nvars)
+{
+    get(solver).setPriorityHints(weight, nvars);
+}
+
+void ipasir_glcb_set_bridges(void* solver, const unsigned char* bridge, int nvars)
+{
+    vec<bool> b(nvars);
+    for (int i = 0; i < nvars; i++) b[i] = bridge[i] != 0;
+    get(solver).setBridgeHints((bool*)b, nvars);
+}
@@ -0,0 +1,47 @@
+/***************************************************************************************[Ipasir.h]
+ IPASIR interface of the solver (the incremental API of the SAT Race 2015), with an extension for
+ structural hints. Built into the library of 'make libr' in simp/.
+
+ Same licence as the rest of Glucose (see LICENCE).
+ **************************************************************************************************/
+
+#ifndef Glucose_Ipasir_h
+#define Glucose_Ipasir_h
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Standard IPASIR. Literals are DIMACS style and variables are created as they appear. Clauses
+// may be added and assumptions given between solves; the assumptions hold for the next
+// 'ipasir_solve' only. 'ipasir_solve' returns 10 (SAT), 20 (UNSAT) or 0 (terminated). The
+// callbacks run in the thread of 'ipasir_solve': 'terminate' is polled at every conflict, 'learn'
+// receives the zero terminated learnt clauses of at most 'max_length' literals.
+const char* ipasir_signature    (void);
+void*       ipasir_init         (void);
+void        ipasir_release      (void* solver);
+void        ipasir_add          (void* solver, int32_t lit_or_zero);
+void        ipasir_assume       (void* solver, int32_t lit);
+int         ipasir_solve        (void* solver);
+int32_t     ipasir_val          (void* solver, int32_t lit);
+int         ipasir_failed       (void* solver, int32_t lit);
+void        ipasir_set_terminate(void* solver, void* data, int (*terminate)(void* data));
+void        ipasir_set_learn    (void* solver, void* data, int max_length, void (*learn)(void* data, int32_t* clause));
+
+// Extension: structural hints, entry i for variable i+1, copied. They may be given at any time
+// between solves and replace the previous ones; the next 'ipasir_solve' uses them without
+// recomputing the graph metadata.
+//   * 'weight': bump multiplier of the variable in conflict analysis (as the centrality scaling
+//     of bump policy 2), replacing that of the bump policy; 0 keeps the policy's. No effect with
+//     bump policy 3.
+//   * 'bridge': nonzero if the variable joins communities, overriding the detected flag.
+void        ipasir_glcb_set_priority(void* solver, const double*        weight, int nvars);
+void        ipasir_glcb_set_bridges (void* solver, const unsigned char* bridge, int nvars);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
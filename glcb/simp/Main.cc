@@ -58,6 +58,11 @@ OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWA
 #include "utils/Options.h"
 #include "core/Dimacs.h"
 #include "simp/SimpSolver.h"
+#include "simp/Distributed.h"
+#include "simp/Batch.h"
+#include "core/ResultCache.h"
+#include "core/Proof.h"
+#include "core/SharedFormula.h"
 
 using namespace Glucose;
 
@@ -94,6 +99,33 @@ void printStats(Solver& solver)
     printf("c CPU time              : %g s\n", cpu_time);
 }
 
+// Name of a shared-memory segment of -shm: "/" (if missing) + 'name' + 'suffix'.
+static const char* shmName(const char* name, const char* suffix)
+{
+    char* s = new char[strlen(name) + strlen(suffix) + 2];
+    sprintf(s, "%s%s%s", name[0] == '/' ? "" : "/", name, suffix);
+    return s;
+}
+
+// Verdict of -certified-check, once the answer is known: waits for the checker to catch up with
+// the proof if the answer is UNSAT, and drops it otherwise. FALSE if the proof did not check.
+static bool reportCheck(ProofChecker* checker, lbool ret)
+{
+    if (checker == NULL) return true;
+    if (ret != l_False) {
+        checker->cancel();
+        return true; }
+
+    double start = realTime();
+    bool   ok    = checker->finish();
+    printf("c proof check           : %s (%" PRIu64" lemmas, %.2f s after the search)\n", ok ? "VERIFIED" : "NOT VERIFIED", checker->lemmas(), realTime() - start);
+    if (checker->failedAt() > 0)
+        printf("c proof check           : lemma %" PRIu64" is not implied by unit propagation\n", checker->failedAt());
+    if (checker->missing() > 0)
+        printf("c proof check           : %" PRIu64" deletions of unknown clauses ignored\n", checker->missing());
+    return ok;
+}
+
 
 
 static Solver* solver;
@@ -101,6 +133,9 @@ static Solver* solver;
 // for this feature of the Solver as it may take longer than an immediate call to '_exit()'.
 static void SIGINT_interrupt(int signum) { solver->interrupt(); }
 
+// Ask for a checkpoint at the next restart, without stopping the search.
+static void SIGUSR1_checkpoint(int signum) { solver->checkpointRequested = true; }
+
 // Note that '_exit()' rather than 'exit()' has to be used. The reason is that 'exit()' calls
 // destructors and may cause deadlocks if a malloc/free function happens to be running (these
 // functions are guarded by locks for multithreaded use).
@@ -136,14 +171,37 @@ int main(int argc, char** argv)
         IntOption    vv  ("MAIN", "vv",   "Verbosity every vv conflicts", 10000, IntRange(1,INT32_MAX));
         BoolOption   pre    ("MAIN", "pre",    "Completely turn on/off any preprocessing.", true);
         StringOption dimacs ("MAIN", "dimacs", "If given, stop after preprocessing and write the result to this file.");
+        IntOption    parse_threads("MAIN", "parse-threads", "Threads used to parse uncompressed input (0=one per core).", 0, IntRange(0, 1024));
+        IntOption    workers("MAIN", "workers", "Solve in this many worker processes coordinated over Unix sockets (0=in this process).", 0, IntRange(0, 1024));
+        IntOption    worker_retries("MAIN", "worker-retries", "Times a job is given again after its worker died.", 2, IntRange(0, INT32_MAX));
+        StringOption batch  ("MAIN", "batch", "Solve every job of this manifest in a pool of worker processes and exit (see simp/Batch.h).");
+        StringOption batch_out("MAIN", "batch-out", "JSON lines results of -batch (default: standard output).");
+        IntOption    batch_workers("MAIN", "batch-workers", "Worker processes of -batch (0=one per core).", 0, IntRange(0, 1024));
+        StringOption result_cache("MAIN", "result-cache", "Directory of solve results: formulas solved before (up to a renaming of the variables) are answered from it.");
+        StringOption shm    ("MAIN", "shm", "Share the parsed formula (segment /NAME) and the metadata (/NAME.meta) in POSIX shared memory: attached read-only if another process published them, published otherwise.");
+        StringOption warm_save("MAIN", "warm-save", "When the search ends, write its low-LBD learnt clauses, activities and phases to this file.");
+        StringOption warm_load("MAIN", "warm-load", "Resume from a file of -warm-save written for the same formula.");
+        IntOption    warm_lbd ("MAIN", "warm-lbd", "-warm-save keeps the learnt clauses of LBD at most this.", 6, IntRange(0, INT32_MAX));
+        IntOption    warm_max ("MAIN", "warm-max", "-warm-save keeps at most this many learnt clauses.", 100000, IntRange(0, INT32_MAX));
+        StringOption checkpoint("MAIN", "checkpoint", "Resume from this file if it holds a checkpoint of the same formula; write one every -checkpoint-every conflicts, on SIGUSR1 and when interrupted (SIGINT, SIGTERM, SIGXCPU).");
+        IntOption    checkpoint_every("MAIN", "checkpoint-every", "Conflicts between two -checkpoint writes (0=only on a signal).", 100000, IntRange(0, INT32_MAX));
         IntOption    cpu_lim("MAIN", "cpu-lim","Limit on CPU time allowed in seconds.\n", INT32_MAX, IntRange(0, INT32_MAX));
         IntOption    mem_lim("MAIN", "mem-lim","Limit on memory usage in megabytes.\n", INT32_MAX, IntRange(0, INT32_MAX));
  //       BoolOption opt_incremental ("MAIN","incremental", "Use incremental SAT solving",false);
 
          BoolOption    opt_certified      (_certified, "certified",    "Certified UNSAT using DRUP format", false);
          StringOption  opt_certified_file      (_certified, "certified-output",    "Certified UNSAT output file", "NULL");
+         BoolOption    opt_certified_binary    (_certified, "certified-binary",    "Write the proof in binary DRAT", false);
+         BoolOption    opt_certified_gzip      (_certified, "certified-gzip",      "Compress the proof with gzip", false);
+         BoolOption    opt_certified_lrat      (_certified, "certified-lrat",      "Write the proof in LRAT, with clause ids and hints (implies -certified, turns off the preprocessing)", false);
+         IntOption     opt_certified_buffer    (_certified, "certified-buffer",    "Size of the proof buffer in MB", 16, IntRange(1, 4096));
+         BoolOption    opt_certified_check     (_certified, "certified-check",     "Check the proof in a thread while solving (implies -certified; exit status 1 if it does not check)", false);
          
         parseOptions(argc, argv, true);
+
+        // Batch mode: -cpu-lim and -mem-lim apply to every job.
+        if (batch)
+            exit(solveBatch(batch, batch_out, batch_workers, cpu_lim, mem_lim, pre, result_cache));
         
         SimpSolver  S;
         double      initial_time = cpuTime();
@@ -155,15 +213,25 @@ int main(int argc, char** argv)
         S.verbEveryConflicts = vv;
 	S.showModel = mod;
         
-        S.certifiedUNSAT = opt_certified;
+        S.certifiedUNSAT = opt_certified || opt_certified_lrat || opt_certified_check;
+        S.certifiedLRAT  = opt_certified_lrat;
+        ProofChecker* checker = NULL;
         if(S.certifiedUNSAT) {
-            if(!strcmp(opt_certified_file,"NULL")) {
-            S.certifiedOutput =  fopen("/dev/stdout", "wb");
-            } else {
-                S.certifiedOutput =  fopen(opt_certified_file, "wb");	    
-            }
-            fprintf(S.certifiedOutput,"o proof DRUP\n");
+            // When checked, the proof is only written if a file is given:
+            const char* to    = strcmp(opt_certified_file,"NULL") ? (const char*)opt_certified_file : opt_certified_check ? "/dev/null" : "/dev/stdout";
+            FILE*       proof = fopen(to, "wb");
+            if (proof == NULL)
+                printf("ERROR! Could not open proof file: %s\n", (const char*)opt_certified_file), exit(1);
+            S.certifiedOutput = new Proof(proof, opt_certified_binary, opt_certified_gzip, (uint64_t)opt_certified_buffer << 20, opt_certified_lrat);
+            if (opt_certified_check && opt_certified_lrat)
+                printf("c -certified-check ignored: LRAT is checked by lrat-check or cake_lpr\n");
+            else if (opt_certified_check) {
+                checker = new ProofChecker((uint64_t)opt_certified_buffer << 20);
+                S.certifiedOutput->setChecker(checker); }
         }
+        if (shm) S.metaShm = shmName(shm, ".meta");
+        // The simplifier would need hints for its resolvents: turned off (while there is no clause yet).
+        if (S.certifiedLRAT) S.eliminate(true);
 
         solver = &S;
         // Use signal handlers that forcibly quit until the solver will be able to respond to
@@ -205,8 +273,29 @@ int main(int argc, char** argv)
             printf("c |                                                                                                       |\n"); }
         
         FILE* res = (argc >= 3) ? fopen(argv[argc-1], "wb") : NULL;
-        parse_DIMACS(in, S);
+        // With -shm, a formula published by an earlier process for the same file is added from the
+        // segment without parsing; otherwise it is parsed and published (not for stdin):
+        const char*           shm_formula = shm ? shmName(shm, "") : NULL;
+        uint64_t              source      = shm && argc > 1 ? SharedFormula::sourceKey(argv[1]) : 0;
+        SharedFormula         shared;
+        SharedFormula::Status shared_status = source ? shared.attach(shm_formula, source) : SharedFormula::Missing;
+        bool                  published     = false;
+        if (shared_status == SharedFormula::Attached) {
+            parse_DIMACS_image(shared.lits, shared.nLits, shared.vars, shared.clauses, S);
+            shared.close();
+        } else {
+            DimacsImage* keep = source ? new DimacsImage : NULL;
+            // Plain files are mapped and parsed in parallel; stdin and gzipped files are streamed:
+            if (argc == 1 || !parse_DIMACS_mmap(argv[1], S, parse_threads, keep))
+                parse_DIMACS(in, S, keep);
+            if (keep != NULL) {
+                if (shared_status == SharedFormula::Stale) SharedFormula::remove(shm_formula);     // The file changed since.
+                published = SharedFormula::publish(shm_formula, source, keep->vars, keep->clauses, (const int*)keep->lits, keep->lits.size());
+                delete keep; }
+        }
         gzclose(in);
+        if (shm)
+            printf("c shared formula        : %s %s\n", shared_status == SharedFormula::Attached ? "attached" : published ? "published" : source == 0 ? "not shared (not a regular file):" : "not shared (segment in use or not writable):", shm_formula);
 
        if (S.verbosity > 0){
             printf("c |  Number of variables:  %12d                                                                   |\n", S.nVars());
@@ -217,13 +306,41 @@ int main(int argc, char** argv)
             printf("c |  Parse time:           %12.2f s                                                                 |\n", parsed_time - initial_time);
             printf("c |                                                                                                       |\n"); }
 
+        // Identifies the formula for -warm-save, -warm-load and -checkpoint (before any simplification):
+        uint64_t formula_key = warm_save || warm_load || checkpoint ? S.formulaKey() : 0;
+
+        // Look the formula up in the result cache (not for proofs, nor for -dimacs):
+        ResultCache        cache(result_cache);
+        ResultCache::Entry cached;
+        bool               keyed = result_cache && !S.certifiedUNSAT && !dimacs && S.okay();
+        lbool              ret   = keyed ? cache.lookup(S, cached) : l_Undef;
+        if (ret != l_Undef)
+            printf("c result cache          : %s from %016" PRIx64"%s (solved in %g s, %" PRIu64" conflicts)\n",
+                   ret == l_True ? "SAT" : "UNSAT", cache.formulaKey(), cache.renamingInvariant() ? "" : " (exact)",
+                   cached.cpu, cached.conflicts);
+
         // Change to signal-handlers that will only notify the solver and allow it to terminate
         // voluntarily:
         signal(SIGINT, SIGINT_interrupt);
         signal(SIGXCPU,SIGINT_interrupt);
 
         S.parsing = 0;
-        if(pre/* && !S.isIncremental()*/) {
+
+        // Resume from a checkpoint of this formula: its clauses are simplified already. Not for
+        // proofs, which would miss their beginning.
+        bool resumed = false;
+        if (checkpoint && ret == l_Undef && !S.certifiedUNSAT && S.okay()) {
+            resumed = S.loadCheckpoint(checkpoint, formula_key);
+            if (resumed)
+                printf("c checkpoint            : resumed from %s at %" PRIu64" conflicts\n", (const char*)checkpoint, S.conflicts);
+            S.checkpointFile  = checkpoint;
+            S.checkpointKey   = formula_key;
+            S.checkpointEvery = checkpoint_every;
+            signal(SIGUSR1, SIGUSR1_checkpoint);
+            signal(SIGTERM, SIGINT_interrupt);
+        }
+
+        if(pre && ret == l_Undef && !resumed/* && !S.isIncremental()*/) {
 	  printf("c | Preprocesing is fully done\n");
 	  S.eliminate(true);
         double simplified_time = cpuTime();
@@ -233,8 +350,11 @@ int main(int argc, char** argv)
 	}
 	printf("c |                                                                                                       |\n");
         if (!S.okay()){
-            if (S.certifiedUNSAT) fprintf(S.certifiedOutput, "0\n"), fclose(S.certifiedOutput);
+            if (S.certifiedUNSAT) S.certifiedOutput->addEmpty(), S.certifiedOutput->close();
+            if (!reportCheck(checker, l_False)) printf("s UNKNOWN\n"), exit(1);
             if (res != NULL) fprintf(res, "UNSAT\n"), fclose(res);
+            if (keyed) cache.store(S, l_False, cpuTime() - parsed_time);
+            if (S.checkpointFile) remove(S.checkpointFile);
             if (S.verbosity > 0){
  	        printf("c =========================================================================================================\n");
                printf("Solved by simplification\n");
@@ -253,12 +373,36 @@ int main(int argc, char** argv)
             exit(0);
         }
 
+        if (warm_load && ret == l_Undef && !S.certifiedUNSAT && !resumed) {     // Loaded clauses would not be in the proof.
+            int n = S.loadWarmStart(warm_load, formula_key);
+            if (n >= 0) printf("c warm start            : %d clauses from %s\n", n, (const char*)warm_load);
+            else        printf("c warm start            : %s ignored (missing, damaged or for another formula)\n", (const char*)warm_load);
+        }
+
         vec<Lit> dummy;
-        lbool ret = S.solveLimited(dummy);
+        // Certified UNSAT needs the whole proof in one process:
+        if (ret == l_Undef) {
+            ret = workers > 0 && !S.certifiedUNSAT ? solveDistributed(S, workers, worker_retries) : S.solveLimited(dummy);
+            if (keyed && ret != l_Undef) cache.store(S, ret, cpuTime() - parsed_time);
+            // Also after an interrupt (SIGINT, or SIGXCPU at -cpu-lim):
+            if (warm_save && !S.saveWarmStart(warm_save, formula_key, warm_lbd, warm_max))
+                printf("c WARNING! Could not write %s\n", (const char*)warm_save);
+            if (S.checkpointFile) {
+                if (ret != l_Undef)
+                    remove(S.checkpointFile);       // Nothing left to resume.
+                else if (!S.saveCheckpoint(S.checkpointFile, formula_key))
+                    printf("c WARNING! Could not write %s\n", S.checkpointFile);
+                else
+                    printf("c checkpoint            : %s at %" PRIu64" conflicts\n", S.checkpointFile, S.conflicts);
+            }
+        }
         
         if (S.verbosity > 0){
             printStats(S);
             printf("\n"); }
+        if (!reportCheck(checker, ret)) {
+            printf("s UNKNOWN\n");
+            exit(1); }
         printf(ret == l_True ? "s SATISFIABLE\n" : ret == l_False ? "s UNSATISFIABLE\n" : "s INDETERMINATE\n");
 
         if (res != NULL){
@@ -285,7 +429,9 @@ int main(int argc, char** argv)
 
 	}
 
-        if (S.certifiedUNSAT) fprintf(S.certifiedOutput, "0\n"), fclose(S.certifiedOutput);
+        // The empty clause was written by the search if it found the formula UNSAT:
+        if (S.certifiedUNSAT && !S.certifiedOutput->close())
+            printf("c WARNING! Could not write the proof\n");
 
 #ifdef NDEBUG
         exit(ret == l_True ? 10 : ret == l_False ? 20 : 0);     // (faster than "return", which will invoke the destructor for 'Solver')
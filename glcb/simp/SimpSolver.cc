@@ -48,6 +48,8 @@ OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWA
  **************************************************************************************************/
 
 #include "mtl/Sort.h"
+#include "core/Checkpoint.h"
+#include "core/Proof.h"
 #include "simp/SimpSolver.h"
 #include "utils/System.h"
 
@@ -213,17 +215,17 @@ bool SimpSolver::addClause_(vec<Lit>& ps)
 #endif
     int nclauses = clauses.size();
 
-    if (use_rcheck && implied(ps))
+    if (certifiedUNSAT && parsing)
+        certifiedOutput->original(ps);
+
+    if (use_rcheck && !certifiedLRAT && implied(ps))     // (LRAT numbers every input clause)
         return true;
 
     if (!Solver::addClause_(ps))
         return false;
 
-    if(!parsing && certifiedUNSAT) {
-      for (int i = 0; i < ps.size(); i++)
-        fprintf(certifiedOutput, "%i " , (var(ps[i]) + 1) * (-2 * sign(ps[i]) + 1) );
-      fprintf(certifiedOutput, "0\n");
-    }
+    if(!parsing && certifiedUNSAT && !certifiedLRAT)
+        certifiedOutput->add(ps);
 
     if (use_simplification && clauses.size() == nclauses + 1){
         CRef          cr = clauses.last();
@@ -276,22 +278,15 @@ bool SimpSolver::strengthenClause(CRef cr, Lit l)
     // if (!find(subsumption_queue, &c))
     subsumption_queue.insert(cr);
 
-    if (certifiedUNSAT) {
-      for (int i = 0; i < c.size(); i++)
-        if (c[i] != l) fprintf(certifiedOutput, "%i " , (var(c[i]) + 1) * (-2 * sign(c[i]) + 1) );
-      fprintf(certifiedOutput, "0\n");
-    }
+    if (certifiedUNSAT)
+        certifiedOutput->add(c, l);
 
     if (c.size() == 2){
         removeClause(cr);
         c.strengthen(l);
     }else{
-        if (certifiedUNSAT) {
-          fprintf(certifiedOutput, "d ");
-          for (int i = 0; i < c.size(); i++)
-            fprintf(certifiedOutput, "%i " , (var(c[i]) + 1) * (-2 * sign(c[i]) + 1) );
-          fprintf(certifiedOutput, "0\n");
-        }
+        if (certifiedUNSAT)
+            certifiedOutput->remove(c);
 
         detachClause(cr, true);
         c.strengthen(l);
@@ -425,7 +420,7 @@ bool SimpSolver::backwardSubsumptionCheck(bool verbose)
     while (subsumption_queue.size() > 0 || bwdsub_assigns < trail.size()){
 
         // Empty subsumption queue and return immediately on user-interrupt:
-        if (asynch_interrupt){
+        if (interrupted()){
             subsumption_queue.clear();
             bwdsub_assigns = trail.size();
             break; }
@@ -701,7 +696,7 @@ bool SimpSolver::eliminate(bool turn_off_elim)
             ok = false; goto cleanup; }
 
         // Empty elim_heap and return immediately on user-interrupt:
-        if (asynch_interrupt){
+        if (interrupted()){
             assert(bwdsub_assigns == trail.size());
             assert(subsumption_queue.size() == 0);
             assert(n_touched == 0);
@@ -712,7 +707,7 @@ bool SimpSolver::eliminate(bool turn_off_elim)
         for (int cnt = 0; !elim_heap.empty(); cnt++){
             Var elim = elim_heap.removeMin();
             
-            if (asynch_interrupt) break;
+            if (interrupted()) break;
 
             if (isEliminated(elim) || value(elim) != l_Undef) continue;
 
@@ -824,3 +819,46 @@ void SimpSolver::garbageCollect()
                ca.size()*ClauseAllocator::Unit_Size, to.size()*ClauseAllocator::Unit_Size);
     to.moveTo(ca);
 }
+
+
+//=================================================================================================
+// Checkpoints:
+
+
+// The eliminated variables and their clauses follow the state of 'Solver', so that a resumed
+// search still extends its models to the eliminated variables.
+void SimpSolver::writeState(CheckpointWriter& out)
+{
+    Solver::writeState(out);
+    out.put((char*)eliminated, nVars());
+    out.put((char*)frozen,     nVars());
+    out.put(elimclauses);
+    out.put(eliminated_vars);
+    out.put(merges);
+    out.put(asymm_lits);
+}
+
+
+// The clauses read are simplified already: simplification is turned off first (as by
+// 'eliminate(true)'), its occurrence lists referring to the clause arena that is replaced.
+void SimpSolver::readState(CheckpointReader& in)
+{
+    if (use_simplification){
+        touched  .clear(true);
+        occurs   .clear(true);
+        n_occ    .clear(true);
+        elim_heap.clear(true);
+        subsumption_queue.clear(true);
+
+        use_simplification    = false;
+        remove_satisfied      = true;
+        ca.extra_clause_field = false;
+    }
+    Solver::readState(in);
+    in.get((char*)eliminated, nVars());
+    in.get((char*)frozen,     nVars());
+    in.get(elimclauses);
+    in.get(eliminated_vars);
+    in.get(merges);
+    in.get(asymm_lits);
+}
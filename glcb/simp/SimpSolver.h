@@ -199,6 +199,8 @@ class SimpSolver : public Solver {
     void          cleanUpClauses           ();
     bool          implied                  (const vec<Lit>& c);
     virtual void          relocAll                 (ClauseAllocator& to);
+    virtual void          writeState               (CheckpointWriter& out);
+    virtual void          readState                (CheckpointReader& in);
 };
 
 
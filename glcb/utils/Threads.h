@@ -0,0 +1,38 @@
+/**************************************************************************************[Threads.h]
+ Small helpers for the multi-threaded preprocessing stages (graph building, community detection,
+ centrality). Built on C++11 threads; the makefiles already link with -lpthread.
+
+ Same licence as the rest of Glucose (see LICENCE).
+ **************************************************************************************************/
+
+#ifndef Glucose_Threads_h
+#define Glucose_Threads_h
+
+#include <thread>
+#include <vector>
+
+namespace Glucose {
+
+// Number of threads to use when the user asked for 'requested' (0 means one per core).
+static inline int effectiveThreads(int requested) {
+    if (requested > 0) return requested;
+    int hw = (int)std::thread::hardware_concurrency();
+    return hw > 0 ? hw : 1;
+}
+
+// Runs 'f(tid)' for tid = 0 .. nthreads-1, each on its own thread, and waits for all of them.
+// With a single thread, 'f(0)' is simply called on the current thread.
+template<class F>
+static inline void runThreads(int nthreads, F f) {
+    if (nthreads <= 1) { f(0); return; }
+    std::vector<std::thread> ts;
+    for (int t = 1; t < nthreads; t++)
+        ts.push_back(std::thread(f, t));
+    f(0);
+    for (size_t t = 0; t < ts.size(); t++)
+        ts[t].join();
+}
+
+}
+
+#endif
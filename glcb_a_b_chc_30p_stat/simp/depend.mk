@@ -1,40 +0,0 @@
-/local-scratch/lucy/Continuous_Bumping/bridge_btw_centrality_continuous_1.1_glpb_i_hc_derivation/simp/Main.o /local-scratch/lucy/Continuous_Bumping/bridge_btw_centrality_continuous_1.1_glpb_i_hc_derivation/simp/Main.or /local-scratch/lucy/Continuous_Bumping/bridge_btw_centrality_continuous_1.1_glpb_i_hc_derivation/simp/Main.od /local-scratch/lucy/Continuous_Bumping/bridge_btw_centrality_continuous_1.1_glpb_i_hc_derivation/simp/Main.op: \
- /local-scratch/lucy/Continuous_Bumping/bridge_btw_centrality_continuous_1.1_glpb_i_hc_derivation/simp/Main.cc \
- /local-scratch/lucy/Continuous_Bumping/bridge_btw_centrality_continuous_1.1_glpb_i_hc_derivation/simp/../utils/System.h \
- /local-scratch/lucy/Continuous_Bumping/bridge_btw_centrality_continuous_1.1_glpb_i_hc_derivation/simp/../mtl/IntTypes.h \
- /local-scratch/lucy/Continuous_Bumping/bridge_btw_centrality_continuous_1.1_glpb_i_hc_derivation/simp/../utils/ParseUtils.h \
- /local-scratch/lucy/Continuous_Bumping/bridge_btw_centrality_continuous_1.1_glpb_i_hc_derivation/simp/../utils/Options.h \
- /local-scratch/lucy/Continuous_Bumping/bridge_btw_centrality_continuous_1.1_glpb_i_hc_derivation/simp/../mtl/Vec.h \
- /local-scratch/lucy/Continuous_Bumping/bridge_btw_centrality_continuous_1.1_glpb_i_hc_derivation/simp/../mtl/XAlloc.h \
- /local-scratch/lucy/Continuous_Bumping/bridge_btw_centrality_continuous_1.1_glpb_i_hc_derivation/simp/../core/Dimacs.h \
- /local-scratch/lucy/Continuous_Bumping/bridge_btw_centrality_continuous_1.1_glpb_i_hc_derivation/simp/../core/SolverTypes.h \
- /local-scratch/lucy/Continuous_Bumping/bridge_btw_centrality_continuous_1.1_glpb_i_hc_derivation/simp/../mtl/Alg.h \
- /local-scratch/lucy/Continuous_Bumping/bridge_btw_centrality_continuous_1.1_glpb_i_hc_derivation/simp/../mtl/Map.h \
- /local-scratch/lucy/Continuous_Bumping/bridge_btw_centrality_continuous_1.1_glpb_i_hc_derivation/simp/../mtl/Alloc.h \
- /local-scratch/lucy/Continuous_Bumping/bridge_btw_centrality_continuous_1.1_glpb_i_hc_derivation/simp/../simp/SimpSolver.h \
- /local-scratch/lucy/Continuous_Bumping/bridge_btw_centrality_continuous_1.1_glpb_i_hc_derivation/simp/../mtl/Queue.h \
- /local-scratch/lucy/Continuous_Bumping/bridge_btw_centrality_continuous_1.1_glpb_i_hc_derivation/simp/../core/Solver.h \
- /local-scratch/lucy/Continuous_Bumping/bridge_btw_centrality_continuous_1.1_glpb_i_hc_derivation/simp/../mtl/Heap.h \
- /local-scratch/lucy/Continuous_Bumping/bridge_btw_centrality_continuous_1.1_glpb_i_hc_derivation/simp/../core/BoundedQueue.h \
- /local-scratch/lucy/Continuous_Bumping/bridge_btw_centrality_continuous_1.1_glpb_i_hc_derivation/simp/../core/Constants.h \
- /local-scratch/lucy/Continuous_Bumping/bridge_btw_centrality_continuous_1.1_glpb_i_hc_derivation/simp/../mtl/Clone.h
-/local-scratch/lucy/Continuous_Bumping/bridge_btw_centrality_continuous_1.1_glpb_i_hc_derivation/simp/SimpSolver.o /local-scratch/lucy/Continuous_Bumping/bridge_btw_centrality_continuous_1.1_glpb_i_hc_derivation/simp/SimpSolver.or /local-scratch/lucy/Continuous_Bumping/bridge_btw_centrality_continuous_1.1_glpb_i_hc_derivation/simp/SimpSolver.od /local-scratch/lucy/Continuous_Bumping/bridge_btw_centrality_continuous_1.1_glpb_i_hc_derivation/simp/SimpSolver.op: \
- /local-scratch/lucy/Continuous_Bumping/bridge_btw_centrality_continuous_1.1_glpb_i_hc_derivation/simp/SimpSolver.cc \
- /local-scratch/lucy/Continuous_Bumping/bridge_btw_centrality_continuous_1.1_glpb_i_hc_derivation/simp/../mtl/Sort.h \
- /local-scratch/lucy/Continuous_Bumping/bridge_btw_centrality_continuous_1.1_glpb_i_hc_derivation/simp/../mtl/Vec.h \
- /local-scratch/lucy/Continuous_Bumping/bridge_btw_centrality_continuous_1.1_glpb_i_hc_derivation/simp/../mtl/IntTypes.h \
- /local-scratch/lucy/Continuous_Bumping/bridge_btw_centrality_continuous_1.1_glpb_i_hc_derivation/simp/../mtl/XAlloc.h \
- /local-scratch/lucy/Continuous_Bumping/bridge_btw_centrality_continuous_1.1_glpb_i_hc_derivation/simp/../simp/SimpSolver.h \
- /local-scratch/lucy/Continuous_Bumping/bridge_btw_centrality_continuous_1.1_glpb_i_hc_derivation/simp/../mtl/Queue.h \
- /local-scratch/lucy/Continuous_Bumping/bridge_btw_centrality_continuous_1.1_glpb_i_hc_derivation/simp/../core/Solver.h \
- /local-scratch/lucy/Continuous_Bumping/bridge_btw_centrality_continuous_1.1_glpb_i_hc_derivation/simp/../mtl/Heap.h \
- /local-scratch/lucy/Continuous_Bumping/bridge_btw_centrality_continuous_1.1_glpb_i_hc_derivation/simp/../mtl/Alg.h \
- /local-scratch/lucy/Continuous_Bumping/bridge_btw_centrality_continuous_1.1_glpb_i_hc_derivation/simp/../utils/Options.h \
- /local-scratch/lucy/Continuous_Bumping/bridge_btw_centrality_continuous_1.1_glpb_i_hc_derivation/simp/../utils/ParseUtils.h \
- /local-scratch/lucy/Continuous_Bumping/bridge_btw_centrality_continuous_1.1_glpb_i_hc_derivation/simp/../core/SolverTypes.h \
- /local-scratch/lucy/Continuous_Bumping/bridge_btw_centrality_continuous_1.1_glpb_i_hc_derivation/simp/../mtl/Map.h \
- /local-scratch/lucy/Continuous_Bumping/bridge_btw_centrality_continuous_1.1_glpb_i_hc_derivation/simp/../mtl/Alloc.h \
- /local-scratch/lucy/Continuous_Bumping/bridge_btw_centrality_continuous_1.1_glpb_i_hc_derivation/simp/../core/BoundedQueue.h \
- /local-scratch/lucy/Continuous_Bumping/bridge_btw_centrality_continuous_1.1_glpb_i_hc_derivation/simp/../core/Constants.h \
- /local-scratch/lucy/Continuous_Bumping/bridge_btw_centrality_continuous_1.1_glpb_i_hc_derivation/simp/../mtl/Clone.h \
- /local-scratch/lucy/Continuous_Bumping/bridge_btw_centrality_continuous_1.1_glpb_i_hc_derivation/simp/../utils/System.h
@@ -1,40 +0,0 @@
-/cs/cll-research/SAT-experiments-Lucy/cleaned_glcb_a_c_scaled/simp/SimpSolver.o /cs/cll-research/SAT-experiments-Lucy/cleaned_glcb_a_c_scaled/simp/SimpSolver.or /cs/cll-research/SAT-experiments-Lucy/cleaned_glcb_a_c_scaled/simp/SimpSolver.od /cs/cll-research/SAT-experiments-Lucy/cleaned_glcb_a_c_scaled/simp/SimpSolver.op: \
- /cs/cll-research/SAT-experiments-Lucy/cleaned_glcb_a_c_scaled/simp/SimpSolver.cc \
- /cs/cll-research/SAT-experiments-Lucy/cleaned_glcb_a_c_scaled/simp/../mtl/Sort.h \
- /cs/cll-research/SAT-experiments-Lucy/cleaned_glcb_a_c_scaled/simp/../mtl/Vec.h \
- /cs/cll-research/SAT-experiments-Lucy/cleaned_glcb_a_c_scaled/simp/../mtl/IntTypes.h \
- /cs/cll-research/SAT-experiments-Lucy/cleaned_glcb_a_c_scaled/simp/../mtl/XAlloc.h \
- /cs/cll-research/SAT-experiments-Lucy/cleaned_glcb_a_c_scaled/simp/../simp/SimpSolver.h \
- /cs/cll-research/SAT-experiments-Lucy/cleaned_glcb_a_c_scaled/simp/../mtl/Queue.h \
- /cs/cll-research/SAT-experiments-Lucy/cleaned_glcb_a_c_scaled/simp/../core/Solver.h \
- /cs/cll-research/SAT-experiments-Lucy/cleaned_glcb_a_c_scaled/simp/../mtl/Heap.h \
- /cs/cll-research/SAT-experiments-Lucy/cleaned_glcb_a_c_scaled/simp/../mtl/Alg.h \
- /cs/cll-research/SAT-experiments-Lucy/cleaned_glcb_a_c_scaled/simp/../utils/Options.h \
- /cs/cll-research/SAT-experiments-Lucy/cleaned_glcb_a_c_scaled/simp/../utils/ParseUtils.h \
- /cs/cll-research/SAT-experiments-Lucy/cleaned_glcb_a_c_scaled/simp/../core/SolverTypes.h \
- /cs/cll-research/SAT-experiments-Lucy/cleaned_glcb_a_c_scaled/simp/../mtl/Map.h \
- /cs/cll-research/SAT-experiments-Lucy/cleaned_glcb_a_c_scaled/simp/../mtl/Alloc.h \
- /cs/cll-research/SAT-experiments-Lucy/cleaned_glcb_a_c_scaled/simp/../core/BoundedQueue.h \
- /cs/cll-research/SAT-experiments-Lucy/cleaned_glcb_a_c_scaled/simp/../core/Constants.h \
- /cs/cll-research/SAT-experiments-Lucy/cleaned_glcb_a_c_scaled/simp/../mtl/Clone.h \
- /cs/cll-research/SAT-experiments-Lucy/cleaned_glcb_a_c_scaled/simp/../utils/System.h
-/cs/cll-research/SAT-experiments-Lucy/cleaned_glcb_a_c_scaled/simp/Main.o /cs/cll-research/SAT-experiments-Lucy/cleaned_glcb_a_c_scaled/simp/Main.or /cs/cll-research/SAT-experiments-Lucy/cleaned_glcb_a_c_scaled/simp/Main.od /cs/cll-research/SAT-experiments-Lucy/cleaned_glcb_a_c_scaled/simp/Main.op: \
- /cs/cll-research/SAT-experiments-Lucy/cleaned_glcb_a_c_scaled/simp/Main.cc \
- /cs/cll-research/SAT-experiments-Lucy/cleaned_glcb_a_c_scaled/simp/../utils/System.h \
- /cs/cll-research/SAT-experiments-Lucy/cleaned_glcb_a_c_scaled/simp/../mtl/IntTypes.h \
- /cs/cll-research/SAT-experiments-Lucy/cleaned_glcb_a_c_scaled/simp/../utils/ParseUtils.h \
- /cs/cll-research/SAT-experiments-Lucy/cleaned_glcb_a_c_scaled/simp/../utils/Options.h \
- /cs/cll-research/SAT-experiments-Lucy/cleaned_glcb_a_c_scaled/simp/../mtl/Vec.h \
- /cs/cll-research/SAT-experiments-Lucy/cleaned_glcb_a_c_scaled/simp/../mtl/XAlloc.h \
- /cs/cll-research/SAT-experiments-Lucy/cleaned_glcb_a_c_scaled/simp/../core/Dimacs.h \
- /cs/cll-research/SAT-experiments-Lucy/cleaned_glcb_a_c_scaled/simp/../core/SolverTypes.h \
- /cs/cll-research/SAT-experiments-Lucy/cleaned_glcb_a_c_scaled/simp/../mtl/Alg.h \
- /cs/cll-research/SAT-experiments-Lucy/cleaned_glcb_a_c_scaled/simp/../mtl/Map.h \
- /cs/cll-research/SAT-experiments-Lucy/cleaned_glcb_a_c_scaled/simp/../mtl/Alloc.h \
- /cs/cll-research/SAT-experiments-Lucy/cleaned_glcb_a_c_scaled/simp/../simp/SimpSolver.h \
- /cs/cll-research/SAT-experiments-Lucy/cleaned_glcb_a_c_scaled/simp/../mtl/Queue.h \
- /cs/cll-research/SAT-experiments-Lucy/cleaned_glcb_a_c_scaled/simp/../core/Solver.h \
- /cs/cll-research/SAT-experiments-Lucy/cleaned_glcb_a_c_scaled/simp/../mtl/Heap.h \
- /cs/cll-research/SAT-experiments-Lucy/cleaned_glcb_a_c_scaled/simp/../core/BoundedQueue.h \
- /cs/cll-research/SAT-experiments-Lucy/cleaned_glcb_a_c_scaled/simp/../core/Constants.h \
- /cs/cll-research/SAT-experiments-Lucy/cleaned_glcb_a_c_scaled/simp/../mtl/Clone.h
@@ -1,13 +0,0 @@
-#ifndef Glucose_Clone_h
-#define Glucose_Clone_h
-
-
-namespace Glucose {
-
-    class Clone {
-        public:
-          virtual Clone* clone() const = 0;
-    };
-};
-
-#endif
\ No newline at end of file